@@ -1,3 +1,6 @@
+#include "parallel_algorithms.hpp"
+#include "statistics.hpp"
+
 #include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_all.hpp>
@@ -29,6 +32,11 @@ TEST_CASE("lambda exercise")
         evens_count = std::count_if(data.begin(), data.end(), is_even);
 
         REQUIRE(evens_count == 4);
+
+        SECTION("parallel & SIMD version")
+        {
+            REQUIRE(Algorithms::count_if(Algorithms::par, data.begin(), data.end(), Algorithms::is_even) == 4);
+        }
     }
 
     SECTION("copy evens to vector")
@@ -84,6 +92,13 @@ TEST_CASE("lambda exercise")
 
             REQUIRE_THAT(data, Equals(vector<int>{1, 8, 13}));
         }
+
+        SECTION("ver 3 - divisibility without % & SIMD compaction")
+        {
+            data.erase(Algorithms::remove_if(Algorithms::seq, data.begin(), data.end(), Algorithms::divisible_by_any(eliminators)), data.end());
+
+            REQUIRE_THAT(data, Equals(vector<int>{1, 8, 13}));
+        }
     }
 
     SECTION("calculate average")
@@ -106,4 +121,19 @@ TEST_CASE("lambda exercise")
             REQUIRE_THAT(greater_than_avg, Equals(vector<int>{13, 12, 45}));
         }
     }
+
+    SECTION("calculate average & partition - single pass statistics & pre-sized outputs")
+    {
+        const auto stats = Algorithms::statistics(Algorithms::seq, data.begin(), data.end());
+
+        REQUIRE_THAT(stats.mean(), WithinAbs(11.2, 0.1));
+        REQUIRE(stats.min() == 1);
+        REQUIRE(stats.max() == 45);
+
+        // for ints: n <= avg <=> n <= floor(avg)
+        auto [less_equal_than_avg, greater_than_avg] = Algorithms::partition_split(Algorithms::seq, data.begin(), data.end(), Algorithms::less_equal(static_cast<int>(std::floor(stats.mean()))));
+
+        REQUIRE_THAT(less_equal_than_avg, Equals(vector<int>{1, 6, 3, 5, 8, 9, 10}));
+        REQUIRE_THAT(greater_than_avg, Equals(vector<int>{13, 12, 45}));
+    }
 }
@@ -0,0 +1,700 @@
+#ifndef PARALLEL_ALGORITHMS_HPP
+#define PARALLEL_ALGORITHMS_HPP
+
+#include "simd_dispatch.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Algorithms
+{
+    // pool of parallel algorithms - chunks are submitted as tasks, the calling thread runs one of them
+    //  & helps with others while waiting (nested parallel calls do not deadlock)
+    inline Concurrency::ThreadPool& default_pool()
+    {
+        static Concurrency::ThreadPool pool;
+        return pool;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // execution policies
+    struct SequencedPolicy
+    {
+    };
+
+    struct ParallelPolicy
+    {
+        Concurrency::ThreadPool* pool = nullptr; // nullptr - default_pool()
+        size_t min_chunk_size = 16 * 1024;
+
+        ParallelPolicy on(Concurrency::ThreadPool& other_pool) const
+        {
+            return ParallelPolicy{&other_pool, min_chunk_size};
+        }
+    };
+
+    inline constexpr SequencedPolicy seq{};
+    inline constexpr ParallelPolicy par{};
+
+    /////////////////////////////////////////////////////////////////////////////
+    // int predicates with AVX2 kernels - lambdas work too, but are tested item by item
+    struct IsEven
+    {
+        bool operator()(int x) const
+        {
+            return x % 2 == 0;
+        }
+
+#ifdef SIMD_HAS_AVX2_PATH
+        SIMD_TARGET_AVX2 __m256i matches(__m256i x) const
+        {
+            return _mm256_cmpeq_epi32(_mm256_and_si256(x, _mm256_set1_epi32(1)), _mm256_setzero_si256());
+        }
+#endif
+    };
+
+    inline constexpr IsEven is_even{};
+
+    // x % d == 0 without division - multiplication by the modular inverse of the odd part of d
+    //  - d = d_odd * 2^shift
+    //  - x divisible by d <=> lowest shift bits of x are zero && x * inverse(d_odd) (mod 2^32) + limit <= 2 * limit
+    //    where limit = (2^31 - 1) / d_odd (quotients of divisible values map to [-limit, limit])
+    class DivisibleBy
+    {
+        uint32_t low_bits_mask_;
+        uint32_t inverse_;
+        uint32_t limit_;
+
+    public:
+        explicit constexpr DivisibleBy(int divisor)
+        {
+            if (divisor == 0)
+                throw std::invalid_argument("Divisor must not be zero");
+
+            uint32_t d = divisor < 0 ? 0u - static_cast<uint32_t>(divisor) : static_cast<uint32_t>(divisor);
+
+            const int shift = std::countr_zero(d);
+            low_bits_mask_ = static_cast<uint32_t>((uint64_t{1} << shift) - 1);
+            d >>= shift;
+
+            if (d == 1) // power of 2 - only low bits are tested (0 * x + 0 <= 0)
+            {
+                inverse_ = 0;
+                limit_ = 0;
+                return;
+            }
+
+            // Newton's iteration - every step doubles the number of correct low bits (d * d == 1 mod 8)
+            uint32_t inverse = d;
+            for (int i = 0; i < 4; ++i)
+                inverse *= 2 - d * inverse;
+
+            inverse_ = inverse;
+            limit_ = INT32_MAX / d;
+        }
+
+        constexpr bool operator()(int x) const
+        {
+            const auto ux = static_cast<uint32_t>(x);
+            return (ux & low_bits_mask_) == 0 && ux * inverse_ + limit_ <= 2 * limit_;
+        }
+
+#ifdef SIMD_HAS_AVX2_PATH
+        SIMD_TARGET_AVX2 __m256i matches(__m256i x) const
+        {
+            const __m256i low_bits = _mm256_and_si256(x, _mm256_set1_epi32(static_cast<int>(low_bits_mask_)));
+            const __m256i shifted_quotient = _mm256_add_epi32(_mm256_mullo_epi32(x, _mm256_set1_epi32(static_cast<int>(inverse_))), _mm256_set1_epi32(static_cast<int>(limit_)));
+
+            const __m256i max_quotient = _mm256_set1_epi32(static_cast<int>(2 * limit_));
+            const __m256i in_range = _mm256_cmpeq_epi32(_mm256_max_epu32(shifted_quotient, max_quotient), max_quotient); // unsigned <=
+
+            return _mm256_and_si256(in_range, _mm256_cmpeq_epi32(low_bits, _mm256_setzero_si256()));
+        }
+#endif
+    };
+
+    inline DivisibleBy divisible_by(int divisor)
+    {
+        return DivisibleBy{divisor};
+    }
+
+    // x divisible by any of the divisors - the eliminators pattern without integer division
+    //  - N == std::dynamic_extent - divisors known at runtime
+    //  - empty set of divisors matches nothing
+    template <size_t N = std::dynamic_extent>
+    class DivisibleByAny
+    {
+        using Divisors = std::conditional_t<N == std::dynamic_extent, std::vector<DivisibleBy>, std::array<DivisibleBy, N>>;
+
+        Divisors divisors_;
+
+        template <size_t... Is>
+        static constexpr std::array<DivisibleBy, N> make_divisors(std::span<const int, N> divisors, std::index_sequence<Is...>)
+        {
+            return {DivisibleBy{divisors[Is]}...};
+        }
+
+    public:
+        explicit constexpr DivisibleByAny(std::span<const int, N> divisors)
+            requires(N != std::dynamic_extent)
+            : divisors_{make_divisors(divisors, std::make_index_sequence<N>{})}
+        {
+        }
+
+        explicit DivisibleByAny(std::span<const int> divisors)
+            requires(N == std::dynamic_extent)
+            : divisors_(divisors.begin(), divisors.end())
+        {
+        }
+
+        constexpr bool operator()(int x) const
+        {
+            for (const auto& divisible_by : divisors_)
+                if (divisible_by(x))
+                    return true;
+            return false;
+        }
+
+#ifdef SIMD_HAS_AVX2_PATH
+        SIMD_TARGET_AVX2 __m256i matches(__m256i x) const
+        {
+            __m256i result = _mm256_setzero_si256();
+            for (const auto& divisible_by : divisors_)
+                result = _mm256_or_si256(result, divisible_by.matches(x));
+            return result;
+        }
+#endif
+    };
+
+    template <size_t N>
+    constexpr DivisibleByAny<N> divisible_by_any(const std::array<int, N>& divisors)
+    {
+        return DivisibleByAny<N>{divisors};
+    }
+
+    inline DivisibleByAny<> divisible_by_any(std::span<const int> divisors)
+    {
+        return DivisibleByAny<>{divisors};
+    }
+
+    // divisors known at compile time - zero divisor is a compilation error
+    template <int... Divisors>
+    inline constexpr DivisibleByAny<sizeof...(Divisors)> divisible_by_any_of{std::array<int, sizeof...(Divisors)>{Divisors...}};
+
+    class LessEqual
+    {
+        int limit_;
+
+    public:
+        explicit constexpr LessEqual(int limit)
+            : limit_{limit}
+        {
+        }
+
+        constexpr bool operator()(int x) const
+        {
+            return x <= limit_;
+        }
+
+#ifdef SIMD_HAS_AVX2_PATH
+        SIMD_TARGET_AVX2 __m256i matches(__m256i x) const
+        {
+            return _mm256_xor_si256(_mm256_cmpgt_epi32(x, _mm256_set1_epi32(limit_)), _mm256_set1_epi32(-1));
+        }
+#endif
+    };
+
+    constexpr LessEqual less_equal(int limit)
+    {
+        return LessEqual{limit};
+    }
+
+    namespace Details
+    {
+#ifdef SIMD_HAS_AVX2_PATH
+        template <typename TPredicate>
+        concept HasAvx2Kernel = requires(const TPredicate& pred, __m256i x) {
+            pred.matches(x);
+        };
+#else
+        template <typename TPredicate>
+        concept HasAvx2Kernel = false;
+#endif
+
+        template <typename TIterator, typename TPredicate>
+        concept SimdScan = std::contiguous_iterator<TIterator>
+            && std::same_as<std::iter_value_t<TIterator>, int>
+            && HasAvx2Kernel<TPredicate>;
+
+        template <typename TPredicate>
+        uint32_t scalar_mask(const int* items, size_t count, const TPredicate& pred)
+        {
+            uint32_t mask = 0;
+            for (size_t i = 0; i < count; ++i)
+                mask |= static_cast<uint32_t>(static_cast<bool>(pred(items[i]))) << i;
+            return mask;
+        }
+
+#ifdef SIMD_HAS_AVX2_PATH
+        template <typename TPredicate, typename TBlockFunction>
+        SIMD_TARGET_AVX2 void scan_blocks_avx2(const int* items, size_t size, const TPredicate& pred, TBlockFunction& block_function)
+        {
+            size_t i = 0;
+            for (; i + 8 <= size; i += 8)
+            {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(items + i));
+                const auto mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(pred.matches(block))));
+                block_function(i, mask, size_t{8});
+            }
+
+            if (i < size)
+                block_function(i, scalar_mask(items + i, size - i, pred), size - i);
+        }
+#endif
+
+        // calls block_function(offset, mask, count) for blocks of 8 items - bit k of mask: pred(items[offset + k])
+        template <typename TPredicate, typename TBlockFunction>
+        void scan_blocks(const int* items, size_t size, const TPredicate& pred, TBlockFunction block_function)
+        {
+#ifdef SIMD_HAS_AVX2_PATH
+            if constexpr (HasAvx2Kernel<TPredicate>)
+            {
+                if (Simd::cpu_has_avx2())
+                {
+                    scan_blocks_avx2(items, size, pred, block_function);
+                    return;
+                }
+            }
+#endif
+            for (size_t i = 0; i < size; i += 8)
+            {
+                const size_t count = std::min<size_t>(8, size - i);
+                block_function(i, scalar_mask(items + i, count, pred), count);
+            }
+        }
+
+        // stores items selected by set bits of mask - visits set bits only
+        template <typename TOutput>
+        TOutput store_selected(const int* items, uint32_t mask, TOutput out)
+        {
+            for (; mask != 0; mask &= mask - 1)
+            {
+                *out = items[std::countr_zero(mask)];
+                ++out;
+            }
+            return out;
+        }
+
+#ifdef SIMD_HAS_AVX2_PATH
+        // k-th nibble - index of the k-th set bit of the mask
+        inline constexpr auto compaction_permutations = [] {
+            std::array<uint32_t, 256> permutations{};
+            for (uint32_t mask = 0; mask < 256; ++mask)
+            {
+                uint32_t position = 0;
+                for (uint32_t i = 0; i < 8; ++i)
+                    if (mask & (1u << i))
+                        permutations[mask] |= i << (4 * position++);
+            }
+            return permutations;
+        }();
+
+        // kept items of a block are packed to the front with one permutation & stored as a whole block
+        //  - out never passes the block being read, so a full store overwrites only items already loaded
+        template <typename TPredicate>
+        SIMD_TARGET_AVX2 int* remove_matches_avx2(int* items, size_t size, const TPredicate& pred)
+        {
+            const __m256i nibble_shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+
+            int* out = items;
+            size_t i = 0;
+            for (; i + 8 <= size; i += 8)
+            {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(items + i));
+                const auto keep = ~static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(pred.matches(block)))) & 0xFF;
+
+                const __m256i permutation = _mm256_srlv_epi32(_mm256_set1_epi32(static_cast<int>(compaction_permutations[keep])), nibble_shifts);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_permutevar8x32_epi32(block, permutation));
+                out += std::popcount(keep);
+            }
+
+            for (; i < size; ++i)
+                if (!pred(items[i]))
+                    *out++ = items[i];
+
+            return out;
+        }
+#endif
+
+        // stable in-place compaction - returns the new end
+        template <typename TPredicate>
+        int* remove_matches(int* items, size_t size, const TPredicate& pred)
+        {
+#ifdef SIMD_HAS_AVX2_PATH
+            if (Simd::cpu_has_avx2())
+                return remove_matches_avx2(items, size, pred);
+#endif
+            int* out = items;
+
+            // out never passes the block being read - the block is loaded before stores overwrite it
+            scan_blocks(items, size, pred, [&](size_t offset, uint32_t mask, size_t count) {
+                const uint32_t keep = ~mask & ((1u << count) - 1);
+                if (keep == (1u << count) - 1 && out == items + offset)
+                    out += count; // nothing removed so far - items stay in place
+                else if (keep != 0)
+                {
+                    int block[8];
+                    std::copy_n(items + offset, count, block);
+                    out = store_selected(block, keep, out);
+                }
+            });
+
+            return out;
+        }
+
+        template <typename TIterator, typename TPredicate>
+        size_t count_matches(TIterator first, size_t size, const TPredicate& pred)
+        {
+            if constexpr (SimdScan<TIterator, TPredicate>)
+            {
+                size_t count = 0;
+                scan_blocks(std::to_address(first), size, pred, [&count](size_t, uint32_t mask, size_t) { count += std::popcount(mask); });
+                return count;
+            }
+            else
+            {
+                return static_cast<size_t>(std::count_if(first, first + size, pred));
+            }
+        }
+
+        struct Chunk
+        {
+            size_t begin;
+            size_t end;
+        };
+
+        inline std::vector<Chunk> make_chunks(size_t size, size_t concurrency, size_t min_chunk_size)
+        {
+            const size_t max_chunks = concurrency * 4; // load balancing
+            const size_t no_of_chunks = std::clamp<size_t>(size / std::max<size_t>(min_chunk_size, 1), 1, max_chunks);
+
+            std::vector<Chunk> chunks(no_of_chunks);
+            for (size_t i = 0; i < no_of_chunks; ++i)
+                chunks[i] = Chunk{size * i / no_of_chunks, size * (i + 1) / no_of_chunks};
+
+            return chunks;
+        }
+
+        inline Concurrency::ThreadPool& pool_of(const ParallelPolicy& policy)
+        {
+            return policy.pool ? *policy.pool : default_pool();
+        }
+
+        // chunk 0 runs on the calling thread, others on the pool - returns when all are done
+        //  & rethrows the first exception thrown by a chunk
+        template <typename TFunction>
+        void for_each_chunk(const ParallelPolicy& policy, const std::vector<Chunk>& chunks, TFunction chunk_function)
+        {
+            Concurrency::ThreadPool& pool = pool_of(policy);
+
+            std::vector<std::future<void>> helpers;
+            helpers.reserve(chunks.size() - 1);
+            for (size_t i = 1; i < chunks.size(); ++i)
+                helpers.push_back(pool.submit([&chunk_function, &chunks, i] { chunk_function(i, chunks[i]); }));
+
+            std::exception_ptr error;
+            try
+            {
+                chunk_function(0, chunks[0]);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            for (auto& helper : helpers) // all chunks must finish - they refer to the caller's frame
+            {
+                try
+                {
+                    pool.wait(helper);
+                }
+                catch (...)
+                {
+                    if (!error)
+                        error = std::current_exception();
+                }
+            }
+
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        inline std::vector<Chunk> make_chunks(const ParallelPolicy& policy, size_t size)
+        {
+            return make_chunks(size, pool_of(policy).size() + 1, policy.min_chunk_size);
+        }
+
+        // exclusive prefix sum - returns total
+        inline size_t to_offsets(std::vector<size_t>& counts)
+        {
+            size_t total = 0;
+            for (auto& count : counts)
+                total += std::exchange(count, total);
+            return total;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // count_if
+    template <std::random_access_iterator TIterator, typename TPredicate>
+    auto count_if(SequencedPolicy, TIterator first, TIterator last, TPredicate pred)
+    {
+        return static_cast<std::iter_difference_t<TIterator>>(Details::count_matches(first, static_cast<size_t>(last - first), pred));
+    }
+
+    template <std::random_access_iterator TIterator, typename TPredicate>
+    auto count_if(const ParallelPolicy& policy, TIterator first, TIterator last, TPredicate pred)
+    {
+        const auto chunks = Details::make_chunks(policy, static_cast<size_t>(last - first));
+
+        std::vector<size_t> counts(chunks.size());
+        Details::for_each_chunk(policy, chunks, [&](size_t i, Details::Chunk chunk) {
+            counts[i] = Details::count_matches(first + chunk.begin, chunk.end - chunk.begin, pred);
+        });
+
+        return static_cast<std::iter_difference_t<TIterator>>(std::accumulate(counts.begin(), counts.end(), size_t{0}));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // copy_if - parallel version requires a random access output (e.g. pre-sized vector)
+    template <std::random_access_iterator TIterator, typename TOutput, typename TPredicate>
+    TOutput copy_if(SequencedPolicy, TIterator first, TIterator last, TOutput out, TPredicate pred)
+    {
+        if constexpr (Details::SimdScan<TIterator, TPredicate> && std::random_access_iterator<TOutput>)
+        {
+            const int* items = std::to_address(first);
+            Details::scan_blocks(items, static_cast<size_t>(last - first), pred, [&](size_t offset, uint32_t mask, size_t) {
+                out = Details::store_selected(items + offset, mask, out);
+            });
+            return out;
+        }
+        else
+        {
+            return std::copy_if(first, last, out, pred);
+        }
+    }
+
+    template <std::random_access_iterator TIterator, std::random_access_iterator TOutput, typename TPredicate>
+    TOutput copy_if(const ParallelPolicy& policy, TIterator first, TIterator last, TOutput out, TPredicate pred)
+    {
+        const auto chunks = Details::make_chunks(policy, static_cast<size_t>(last - first));
+
+        std::vector<size_t> offsets(chunks.size());
+        Details::for_each_chunk(policy, chunks, [&](size_t i, Details::Chunk chunk) {
+            offsets[i] = Details::count_matches(first + chunk.begin, chunk.end - chunk.begin, pred);
+        });
+
+        const size_t total = Details::to_offsets(offsets);
+
+        Details::for_each_chunk(policy, chunks, [&](size_t i, Details::Chunk chunk) {
+            Algorithms::copy_if(seq, first + chunk.begin, first + chunk.end, out + offsets[i], pred);
+        });
+
+        return out + total;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // transform
+    template <std::random_access_iterator TIterator, typename TOutput, typename TOperation>
+    TOutput transform(SequencedPolicy, TIterator first, TIterator last, TOutput out, TOperation op)
+    {
+        return std::transform(first, last, out, op);
+    }
+
+    template <std::random_access_iterator TIterator, std::random_access_iterator TOutput, typename TOperation>
+    TOutput transform(const ParallelPolicy& policy, TIterator first, TIterator last, TOutput out, TOperation op)
+    {
+        const auto chunks = Details::make_chunks(policy, static_cast<size_t>(last - first));
+
+        Details::for_each_chunk(policy, chunks, [&](size_t, Details::Chunk chunk) {
+            std::transform(first + chunk.begin, first + chunk.end, out + chunk.begin, op);
+        });
+
+        return out + (last - first);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // remove_if - stable, like std::remove_if
+    template <std::random_access_iterator TIterator, typename TPredicate>
+    TIterator remove_if(SequencedPolicy, TIterator first, TIterator last, TPredicate pred)
+    {
+        if constexpr (Details::SimdScan<TIterator, TPredicate>)
+        {
+            int* items = std::to_address(first);
+            return first + (Details::remove_matches(items, static_cast<size_t>(last - first), pred) - items);
+        }
+        else
+        {
+            return std::remove_if(first, last, pred);
+        }
+    }
+
+    template <std::random_access_iterator TIterator, typename TPredicate>
+    TIterator remove_if(const ParallelPolicy& policy, TIterator first, TIterator last, TPredicate pred)
+    {
+        const auto chunks = Details::make_chunks(policy, static_cast<size_t>(last - first));
+
+        // 1st phase - every chunk is compacted in place (in parallel)
+        std::vector<size_t> kept(chunks.size());
+        Details::for_each_chunk(policy, chunks, [&](size_t i, Details::Chunk chunk) {
+            kept[i] = static_cast<size_t>(Algorithms::remove_if(seq, first + chunk.begin, first + chunk.end, pred) - (first + chunk.begin));
+        });
+
+        // 2nd phase - chunks are moved together (sequentially - destinations overlap sources of earlier chunks)
+        auto out = first + kept.front();
+        for (size_t i = 1; i < chunks.size(); ++i)
+            out = std::move(first + chunks[i].begin, first + chunks[i].begin + kept[i], out);
+
+        return out;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // accumulate - parallel version gives the same result as serial for associative operations
+    //  (e.g. integer addition, integer-valued doubles below 2^53)
+    template <std::random_access_iterator TIterator, typename T, typename TOperation = std::plus<>>
+    T accumulate(SequencedPolicy, TIterator first, TIterator last, T init, TOperation op = {})
+    {
+        return std::accumulate(first, last, std::move(init), op);
+    }
+
+    // parallel version starts every chunk from its first item converted to T & merges partial results with op,
+    // so op must be T x T -> T - heterogeneous folds (e.g. sum of string lengths into size_t) work only with seq
+    template <std::random_access_iterator TIterator, typename T, typename TOperation = std::plus<>>
+        requires std::convertible_to<std::iter_reference_t<TIterator>, T>
+        && std::invocable<TOperation&, T, std::iter_reference_t<TIterator>>
+        && std::invocable<TOperation&, T, T>
+        && std::convertible_to<std::invoke_result_t<TOperation&, T, T>, T>
+    T accumulate(const ParallelPolicy& policy, TIterator first, TIterator last, T init, TOperation op = {})
+    {
+        if (first == last)
+            return init;
+
+        const auto chunks = Details::make_chunks(policy, static_cast<size_t>(last - first));
+
+        std::vector<T> partials(chunks.size());
+        Details::for_each_chunk(policy, chunks, [&](size_t i, Details::Chunk chunk) {
+            partials[i] = std::accumulate(first + chunk.begin + 1, first + chunk.end, static_cast<T>(first[chunk.begin]), op);
+        });
+
+        return std::accumulate(partials.begin(), partials.end(), std::move(init), op);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // partition_copy - parallel version requires random access outputs
+    template <std::random_access_iterator TIterator, typename TOutputTrue, typename TOutputFalse, typename TPredicate>
+    std::pair<TOutputTrue, TOutputFalse> partition_copy(SequencedPolicy, TIterator first, TIterator last, TOutputTrue out_true, TOutputFalse out_false, TPredicate pred)
+    {
+        if constexpr (Details::SimdScan<TIterator, TPredicate> && std::random_access_iterator<TOutputTrue> && std::random_access_iterator<TOutputFalse>)
+        {
+            const int* items = std::to_address(first);
+            Details::scan_blocks(items, static_cast<size_t>(last - first), pred, [&](size_t offset, uint32_t mask, size_t count) {
+                out_true = Details::store_selected(items + offset, mask, out_true);
+                out_false = Details::store_selected(items + offset, ~mask & ((1u << count) - 1), out_false);
+            });
+            return {out_true, out_false};
+        }
+        else
+        {
+            return std::partition_copy(first, last, out_true, out_false, pred);
+        }
+    }
+
+    namespace Details
+    {
+        // counting pass of parallel partition - per chunk offsets of true & false items
+        struct PartitionOffsets
+        {
+            std::vector<size_t> true_offsets;
+            std::vector<size_t> false_offsets;
+            size_t total_true;
+            size_t total_false;
+        };
+
+        template <typename TIterator, typename TPredicate>
+        PartitionOffsets count_partitions(const ParallelPolicy& policy, const std::vector<Chunk>& chunks, TIterator first, const TPredicate& pred)
+        {
+            PartitionOffsets offsets{std::vector<size_t>(chunks.size()), std::vector<size_t>(chunks.size()), 0, 0};
+            for_each_chunk(policy, chunks, [&](size_t i, Chunk chunk) {
+                offsets.true_offsets[i] = count_matches(first + chunk.begin, chunk.end - chunk.begin, pred);
+                offsets.false_offsets[i] = chunk.end - chunk.begin - offsets.true_offsets[i];
+            });
+
+            offsets.total_true = to_offsets(offsets.true_offsets);
+            offsets.total_false = to_offsets(offsets.false_offsets);
+
+            return offsets;
+        }
+    }
+
+    template <std::random_access_iterator TIterator, std::random_access_iterator TOutputTrue, std::random_access_iterator TOutputFalse, typename TPredicate>
+    std::pair<TOutputTrue, TOutputFalse> partition_copy(const ParallelPolicy& policy, TIterator first, TIterator last, TOutputTrue out_true, TOutputFalse out_false, TPredicate pred)
+    {
+        const auto chunks = Details::make_chunks(policy, static_cast<size_t>(last - first));
+        const auto offsets = Details::count_partitions(policy, chunks, first, pred);
+
+        Details::for_each_chunk(policy, chunks, [&](size_t i, Details::Chunk chunk) {
+            Algorithms::partition_copy(seq, first + chunk.begin, first + chunk.end, out_true + offsets.true_offsets[i], out_false + offsets.false_offsets[i], pred);
+        });
+
+        return {out_true + offsets.total_true, out_false + offsets.total_false};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // partition_split - two-way partition into vectors of exact size
+    //  - counting pass (SIMD for predicates with AVX2 kernels) sizes the outputs - no reallocations of back_inserter
+    template <std::random_access_iterator TIterator, typename TPredicate, typename T = std::iter_value_t<TIterator>>
+    std::pair<std::vector<T>, std::vector<T>> partition_split(SequencedPolicy, TIterator first, TIterator last, TPredicate pred)
+    {
+        const auto size = static_cast<size_t>(last - first);
+        const size_t no_of_true = Details::count_matches(first, size, pred);
+
+        std::pair<std::vector<T>, std::vector<T>> result{std::vector<T>(no_of_true), std::vector<T>(size - no_of_true)};
+        Algorithms::partition_copy(seq, first, last, result.first.begin(), result.second.begin(), pred);
+
+        return result;
+    }
+
+    template <std::random_access_iterator TIterator, typename TPredicate, typename T = std::iter_value_t<TIterator>>
+    std::pair<std::vector<T>, std::vector<T>> partition_split(const ParallelPolicy& policy, TIterator first, TIterator last, TPredicate pred)
+    {
+        const auto chunks = Details::make_chunks(policy, static_cast<size_t>(last - first));
+        const auto offsets = Details::count_partitions(policy, chunks, first, pred);
+
+        std::pair<std::vector<T>, std::vector<T>> result{std::vector<T>(offsets.total_true), std::vector<T>(offsets.total_false)};
+
+        Details::for_each_chunk(policy, chunks, [&](size_t i, Details::Chunk chunk) {
+            Algorithms::partition_copy(seq, first + chunk.begin, first + chunk.end,
+                result.first.begin() + offsets.true_offsets[i], result.second.begin() + offsets.false_offsets[i], pred);
+        });
+
+        return result;
+    }
+}
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef STATISTICS_HPP
+#define STATISTICS_HPP
+
+#include "block_moments.hpp"
+#include "parallel_algorithms.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace Algorithms
+{
+    /////////////////////////////////////////////////////////////////////////////
+    // Statistics - count, sum, mean, variance, min & max gathered in a single pass
+    //  - mean & variance are updated with Welford's method - no cancellation of a sum of squares
+    //  - merge() combines statistics of separate ranges (Chan's formula) - e.g. partial results of threads
+    //  - add(span) processes blocks of values with SIMD (int) & merges them - much faster than add() per value
+    //  - sum of integers is exact (as long as it fits in 64 bits)
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    class Statistics
+    {
+    public:
+        using sum_type = Numerics::SumType<T>;
+
+    private:
+        size_t count_ = 0;
+        sum_type sum_ = 0;
+        double mean_ = 0.0;
+        double m2_ = 0.0; // sum of squared deviations from the mean
+        T min_ = std::numeric_limits<T>::max();
+        T max_ = std::numeric_limits<T>::lowest();
+
+    public:
+        void add(T value)
+        {
+            ++count_;
+            sum_ += value;
+
+            const double delta = static_cast<double>(value) - mean_;
+            mean_ += delta / static_cast<double>(count_);
+            m2_ += delta * (static_cast<double>(value) - mean_);
+
+            min_ = std::min(min_, value);
+            max_ = std::max(max_, value);
+        }
+
+        void add(std::span<const T> values)
+        {
+            for (size_t i = 0; i < values.size(); i += Numerics::moments_block_size)
+            {
+                const size_t block_size = std::min(Numerics::moments_block_size, values.size() - i);
+                merge(Numerics::block_moments(values.data() + i, block_size));
+            }
+        }
+
+        void merge(const Statistics& other)
+        {
+            merge(Numerics::Moments<T>{other.count_, other.sum_, other.m2_, other.min_, other.max_}, other.mean_);
+        }
+
+        size_t count() const
+        {
+            return count_;
+        }
+
+        sum_type sum() const
+        {
+            return sum_;
+        }
+
+        // NaN for no values - like accumulate(...) / size()
+        double mean() const
+        {
+            return count_ == 0 ? std::numeric_limits<double>::quiet_NaN() : mean_;
+        }
+
+        // population variance
+        double variance() const
+        {
+            return count_ == 0 ? std::numeric_limits<double>::quiet_NaN() : m2_ / static_cast<double>(count_);
+        }
+
+        double sample_variance() const
+        {
+            return count_ < 2 ? std::numeric_limits<double>::quiet_NaN() : m2_ / static_cast<double>(count_ - 1);
+        }
+
+        double stddev() const
+        {
+            return std::sqrt(variance());
+        }
+
+        T min() const
+        {
+            ensure_not_empty();
+            return min_;
+        }
+
+        T max() const
+        {
+            ensure_not_empty();
+            return max_;
+        }
+
+    private:
+        void merge(const Numerics::Moments<T>& other)
+        {
+            merge(other, static_cast<double>(other.sum) / static_cast<double>(other.count));
+        }
+
+        void merge(const Numerics::Moments<T>& other, double other_mean)
+        {
+            if (other.count == 0)
+                return;
+
+            const size_t total_count = count_ + other.count;
+            const double delta = other_mean - mean_;
+            const double other_weight = static_cast<double>(other.count) / static_cast<double>(total_count);
+
+            mean_ += delta * other_weight;
+            m2_ += other.m2 + delta * delta * static_cast<double>(count_) * other_weight;
+
+            count_ = total_count;
+            sum_ += other.sum;
+            min_ = std::min(min_, other.min);
+            max_ = std::max(max_, other.max);
+        }
+
+        void ensure_not_empty() const
+        {
+            if (count_ == 0)
+                throw std::out_of_range("Statistics of an empty range");
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // statistics - single pass over a range
+    template <std::random_access_iterator TIterator, typename T = std::iter_value_t<TIterator>>
+    Statistics<T> statistics(SequencedPolicy, TIterator first, TIterator last)
+    {
+        Statistics<T> stats;
+
+        if constexpr (std::contiguous_iterator<TIterator>)
+            stats.add(std::span<const T>{std::to_address(first), static_cast<size_t>(last - first)});
+        else
+        {
+            for (; first != last; ++first)
+                stats.add(*first);
+        }
+
+        return stats;
+    }
+
+    template <std::random_access_iterator TIterator, typename T = std::iter_value_t<TIterator>>
+    Statistics<T> statistics(const ParallelPolicy& policy, TIterator first, TIterator last)
+    {
+        const auto chunks = Details::make_chunks(policy, static_cast<size_t>(last - first));
+
+        std::vector<Statistics<T>> partials(chunks.size());
+        Details::for_each_chunk(policy, chunks, [&](size_t i, Details::Chunk chunk) {
+            partials[i] = Algorithms::statistics(seq, first + chunk.begin, first + chunk.end);
+        });
+
+        Statistics<T> stats;
+        for (const auto& partial : partials)
+            stats.merge(partial);
+
+        return stats;
+    }
+}
+
+#endif
@@ -0,0 +1,329 @@
+#include "parallel_algorithms.hpp"
+
+#include <algorithm>
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <climits>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<int> make_random_data(size_t size, int min = -1000, int max = 1000)
+    {
+        std::mt19937 rnd{static_cast<unsigned>(size)};
+        std::uniform_int_distribution<int> distr{min, max};
+
+        std::vector<int> data(size);
+        for (auto& item : data)
+            item = distr(rnd);
+        return data;
+    }
+
+    // same results as std algorithms for a policy & predicate
+    template <typename TPolicy, typename TPredicate>
+    void check_algorithms(const TPolicy& policy, const std::vector<int>& data, TPredicate pred)
+    {
+        INFO("size: " << data.size());
+
+        REQUIRE(Algorithms::count_if(policy, data.begin(), data.end(), pred) == std::count_if(data.begin(), data.end(), pred));
+
+        std::vector<int> expected_copy;
+        std::copy_if(data.begin(), data.end(), std::back_inserter(expected_copy), pred);
+        std::vector<int> copied(data.size());
+        copied.erase(Algorithms::copy_if(policy, data.begin(), data.end(), copied.begin(), pred), copied.end());
+        REQUIRE(copied == expected_copy);
+
+        std::vector<int> expected_removed = data;
+        expected_removed.erase(std::remove_if(expected_removed.begin(), expected_removed.end(), pred), expected_removed.end());
+        std::vector<int> removed = data;
+        removed.erase(Algorithms::remove_if(policy, removed.begin(), removed.end(), pred), removed.end());
+        REQUIRE(removed == expected_removed);
+
+        std::vector<int> expected_true, expected_false;
+        std::partition_copy(data.begin(), data.end(), std::back_inserter(expected_true), std::back_inserter(expected_false), pred);
+        std::vector<int> out_true(data.size()), out_false(data.size());
+        auto [end_true, end_false] = Algorithms::partition_copy(policy, data.begin(), data.end(), out_true.begin(), out_false.begin(), pred);
+        out_true.erase(end_true, out_true.end());
+        out_false.erase(end_false, out_false.end());
+        REQUIRE(out_true == expected_true);
+        REQUIRE(out_false == expected_false);
+    }
+}
+
+TEST_CASE("DivisibleBy")
+{
+    const std::vector<int> divisors = {1, 2, 3, 5, 7, 8, 12, 96, 1000, 65537, INT_MAX, -3, -64, INT_MIN};
+    std::vector<int> values = {0, 1, -1, 2, 3, 96, -96, 255, 1024, INT_MAX, INT_MIN, INT_MIN + 1, INT_MAX - 1};
+    for (int x : make_random_data(10'000, INT_MIN, INT_MAX))
+        values.push_back(x);
+
+    for (int d : divisors)
+    {
+        const auto divisible_by_d = Algorithms::divisible_by(d);
+
+        for (int x : values)
+        {
+            INFO(x << " % " << d);
+            REQUIRE(divisible_by_d(x) == (static_cast<long long>(x) % d == 0));
+        }
+    }
+
+    REQUIRE_THROWS_AS(Algorithms::divisible_by(0), std::invalid_argument);
+}
+
+TEST_CASE("DivisibleByAny")
+{
+    const auto values = make_random_data(10'000, INT_MIN, INT_MAX);
+
+    auto divisible_by_any_of = [](std::vector<int> divisors) {
+        return [divisors](int x) { return std::any_of(divisors.begin(), divisors.end(), [x](int d) { return static_cast<long long>(x) % d == 0; }); };
+    };
+
+    SECTION("runtime set of divisors")
+    {
+        for (const std::vector<int>& divisors : {std::vector<int>{}, {3, 5, 7}, {2, 96, -7}, {1, 11}, {INT_MIN, 65537}})
+        {
+            const auto divisible_by_any = Algorithms::divisible_by_any(divisors);
+            const auto expected = divisible_by_any_of(divisors);
+
+            for (int x : values)
+                REQUIRE(divisible_by_any(x) == expected(x));
+        }
+
+        REQUIRE_THROWS_AS(Algorithms::divisible_by_any(std::vector{3, 0}), std::invalid_argument);
+    }
+
+    SECTION("divisors known at compile time")
+    {
+        constexpr std::array eliminators = {3, 5, 7};
+        constexpr auto divisible_by_any = Algorithms::divisible_by_any(eliminators);
+
+        static_assert(divisible_by_any(35) && divisible_by_any(-9) && !divisible_by_any(8));
+        static_assert(Algorithms::divisible_by_any_of<3, 5, 7>(49));
+
+        const auto expected = divisible_by_any_of({3, 5, 7});
+        for (int x : values)
+            REQUIRE(divisible_by_any(x) == expected(x));
+    }
+}
+
+TEST_CASE("parallel & SIMD algorithms give the same results as std algorithms")
+{
+    Concurrency::ThreadPool pool{3};
+
+    const auto par = Algorithms::ParallelPolicy{.pool = &pool, .min_chunk_size = 64};
+
+    for (size_t size : {0, 1, 7, 8, 9, 63, 100, 1'000, 10'007})
+    {
+        const auto data = make_random_data(size);
+
+        SECTION("is_even - AVX2 kernel")
+        {
+            check_algorithms(Algorithms::seq, data, Algorithms::is_even);
+            check_algorithms(par, data, Algorithms::is_even);
+        }
+
+        SECTION("divisible_by - AVX2 kernel")
+        {
+            check_algorithms(Algorithms::seq, data, Algorithms::divisible_by(3));
+            check_algorithms(par, data, Algorithms::divisible_by(-12));
+        }
+
+        SECTION("divisible_by_any - AVX2 kernel")
+        {
+            check_algorithms(Algorithms::seq, data, Algorithms::divisible_by_any(std::array{3, 5, 7}));
+            check_algorithms(par, data, Algorithms::divisible_by_any(std::vector{2, 9, -25}));
+        }
+
+        SECTION("lambda")
+        {
+            auto gt_100 = [](int x) { return x > 100; };
+            check_algorithms(Algorithms::seq, data, gt_100);
+            check_algorithms(par, data, gt_100);
+        }
+
+        SECTION("transform & accumulate")
+        {
+            auto square = [](int n) { return n * n; };
+
+            std::vector<int> expected(size), squares(size);
+            std::transform(data.begin(), data.end(), expected.begin(), square);
+            Algorithms::transform(par, data.begin(), data.end(), squares.begin(), square);
+            REQUIRE(squares == expected);
+
+            REQUIRE(Algorithms::accumulate(par, data.begin(), data.end(), 0.0) == std::accumulate(data.begin(), data.end(), 0.0));
+            REQUIRE(Algorithms::accumulate(par, data.begin(), data.end(), 1LL, std::plus<>{}) == std::accumulate(data.begin(), data.end(), 1LL));
+        }
+    }
+}
+
+namespace
+{
+    template <typename TPolicy, typename TOperation>
+    concept AccumulatesStringLengths = requires(const TPolicy& policy, const std::vector<std::string>& words, TOperation op) {
+        Algorithms::accumulate(policy, words.begin(), words.end(), size_t{0}, op);
+    };
+}
+
+TEST_CASE("accumulate - parallel version requires op: T x T -> T")
+{
+    auto add_length = [](size_t total, const std::string& word) { return total + word.size(); };
+
+    static_assert(AccumulatesStringLengths<Algorithms::SequencedPolicy, decltype(add_length)>);
+    static_assert(!AccumulatesStringLengths<Algorithms::ParallelPolicy, decltype(add_length)>);
+
+    const std::vector<std::string> words = {"one", "three", "seven"};
+    REQUIRE(Algorithms::accumulate(Algorithms::seq, words.begin(), words.end(), size_t{0}, add_length) == 13);
+}
+
+TEST_CASE("parallel algorithms - exception thrown in a chunk")
+{
+    Concurrency::ThreadPool pool{3};
+    const auto par = Algorithms::ParallelPolicy{.pool = &pool, .min_chunk_size = 10};
+
+    std::vector<int> data(1'000);
+    std::iota(data.begin(), data.end(), 0);
+
+    auto throwing_plus = [](int total, int x) {
+        if (x == 700)
+            throw std::runtime_error("ERROR");
+        return total + x;
+    };
+
+    REQUIRE_THROWS_AS(Algorithms::accumulate(par, data.begin(), data.end(), 0, throwing_plus), std::runtime_error);
+    REQUIRE(Algorithms::accumulate(par, data.begin(), data.end(), 0) == 499'500); // pool is still usable
+}
+
+TEST_CASE("algorithms - std vs SIMD vs parallel", "[.][benchmark]")
+{
+    // 10^9 ints (4 GB) do not fit in memory of a typical CI runner - 10^8 is the largest size
+    for (size_t size : {10, 1'000, 100'000, 10'000'000, 100'000'000})
+    {
+        const auto data = make_random_data(size);
+        std::vector<int> out(size);
+        std::vector<int> out_false(size);
+
+        auto is_even = [](int i) { return i % 2 == 0; };
+        auto divisible_by_3 = [](int i) { return i % 3 == 0; };
+
+        const std::string title = " - size: " + std::to_string(size);
+
+        BENCHMARK("std::count_if [is_even]" + title)
+        {
+            return std::count_if(data.begin(), data.end(), is_even);
+        };
+
+        BENCHMARK("Algorithms::count_if(seq) [is_even]" + title)
+        {
+            return Algorithms::count_if(Algorithms::seq, data.begin(), data.end(), Algorithms::is_even);
+        };
+
+        BENCHMARK("Algorithms::count_if(par) [is_even]" + title)
+        {
+            return Algorithms::count_if(Algorithms::par, data.begin(), data.end(), Algorithms::is_even);
+        };
+
+        BENCHMARK("std::copy_if [% 3]" + title)
+        {
+            return std::copy_if(data.begin(), data.end(), out.begin(), divisible_by_3);
+        };
+
+        BENCHMARK("Algorithms::copy_if(seq) [divisible_by(3)]" + title)
+        {
+            return Algorithms::copy_if(Algorithms::seq, data.begin(), data.end(), out.begin(), Algorithms::divisible_by(3));
+        };
+
+        BENCHMARK("Algorithms::copy_if(par) [divisible_by(3)]" + title)
+        {
+            return Algorithms::copy_if(Algorithms::par, data.begin(), data.end(), out.begin(), Algorithms::divisible_by(3));
+        };
+
+        BENCHMARK("std::partition_copy [is_even]" + title)
+        {
+            return std::partition_copy(data.begin(), data.end(), out.begin(), out_false.begin(), is_even);
+        };
+
+        BENCHMARK("Algorithms::partition_copy(par) [is_even]" + title)
+        {
+            return Algorithms::partition_copy(Algorithms::par, data.begin(), data.end(), out.begin(), out_false.begin(), Algorithms::is_even);
+        };
+
+        BENCHMARK_ADVANCED("std::remove_if [% 3]" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<int> items = data;
+            meter.measure([&] { return std::remove_if(items.begin(), items.end(), divisible_by_3) - items.begin(); });
+        };
+
+        BENCHMARK_ADVANCED("Algorithms::remove_if(par) [divisible_by(3)]" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<int> items = data;
+            meter.measure([&] { return Algorithms::remove_if(Algorithms::par, items.begin(), items.end(), Algorithms::divisible_by(3)) - items.begin(); });
+        };
+
+        BENCHMARK("std::accumulate" + title)
+        {
+            return std::accumulate(data.begin(), data.end(), 0LL);
+        };
+
+        BENCHMARK("Algorithms::accumulate(par)" + title)
+        {
+            return Algorithms::accumulate(Algorithms::par, data.begin(), data.end(), 0LL);
+        };
+    }
+}
+
+TEST_CASE("removing items divisible by any eliminator - modulo vs DivisibleByAny", "[.][benchmark]")
+{
+    const std::array<int, 3> eliminators = {3, 5, 7};
+
+    auto eliminate_ver1 = [&eliminators](int x) {
+        return std::any_of(eliminators.begin(), eliminators.end(), [x](int y) { return x % y == 0; });
+    };
+
+    auto eliminate_ver2 = [&eliminators](int x) {
+        for (auto el : eliminators)
+        {
+            if (x % el == 0)
+                return true;
+        }
+        return false;
+    };
+
+    // billions of items do not fit in memory of a typical CI runner - time per item is what matters
+    for (size_t size : {1'000, 100'000, 10'000'000})
+    {
+        const auto data = make_random_data(size, INT_MIN, INT_MAX);
+        const std::string title = " - size: " + std::to_string(size);
+
+        BENCHMARK_ADVANCED("ver 1 - std::remove_if + any_of" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<int> items = data;
+            meter.measure([&] { return std::remove_if(items.begin(), items.end(), eliminate_ver1) - items.begin(); });
+        };
+
+        BENCHMARK_ADVANCED("ver 2 - std::remove_if + loop" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<int> items = data;
+            meter.measure([&] { return std::remove_if(items.begin(), items.end(), eliminate_ver2) - items.begin(); });
+        };
+
+        BENCHMARK_ADVANCED("Algorithms::remove_if(seq) + divisible_by_any" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<int> items = data;
+            meter.measure([&] { return Algorithms::remove_if(Algorithms::seq, items.begin(), items.end(), Algorithms::divisible_by_any(eliminators)) - items.begin(); });
+        };
+
+        BENCHMARK_ADVANCED("Algorithms::remove_if(par) + divisible_by_any" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<int> items = data;
+            meter.measure([&] { return Algorithms::remove_if(Algorithms::par, items.begin(), items.end(), Algorithms::divisible_by_any(eliminators)) - items.begin(); });
+        };
+    }
+}
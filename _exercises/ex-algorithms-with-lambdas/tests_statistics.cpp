@@ -0,0 +1,176 @@
+#include "statistics.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <climits>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    std::vector<int> make_random_ints(size_t size, int min = -1000, int max = 1000)
+    {
+        std::mt19937 rnd{static_cast<unsigned>(size)};
+        std::uniform_int_distribution<int> distr{min, max};
+
+        std::vector<int> data(size);
+        for (auto& item : data)
+            item = distr(rnd);
+        return data;
+    }
+
+    // textbook two-pass variance
+    double population_variance(const std::vector<int>& data)
+    {
+        const double mean = std::accumulate(data.begin(), data.end(), 0.0) / data.size();
+        return std::accumulate(data.begin(), data.end(), 0.0, [mean](double acc, int x) { return acc + (x - mean) * (x - mean); }) / data.size();
+    }
+}
+
+TEST_CASE("Statistics")
+{
+    SECTION("value by value")
+    {
+        Algorithms::Statistics<double> stats;
+        for (double x : {2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0})
+            stats.add(x);
+
+        REQUIRE(stats.count() == 8);
+        REQUIRE(stats.sum() == 40.0);
+        REQUIRE(stats.mean() == Catch::Approx(5.0));
+        REQUIRE(stats.variance() == Catch::Approx(4.0));
+        REQUIRE(stats.stddev() == Catch::Approx(2.0));
+        REQUIRE(stats.sample_variance() == Catch::Approx(32.0 / 7));
+        REQUIRE(stats.min() == 2.0);
+        REQUIRE(stats.max() == 9.0);
+    }
+
+    SECTION("no values")
+    {
+        Algorithms::Statistics<int> stats;
+
+        REQUIRE(stats.count() == 0);
+        REQUIRE(std::isnan(stats.mean()));
+        REQUIRE_THROWS_AS(stats.min(), std::out_of_range);
+    }
+
+    SECTION("large offset - no cancellation")
+    {
+        Algorithms::Statistics<double> stats;
+        for (double x : {1e9 + 4, 1e9 + 7, 1e9 + 13, 1e9 + 16})
+            stats.add(x);
+
+        REQUIRE(stats.variance() == Catch::Approx(22.5));
+    }
+
+    SECTION("bulk add & merge give the same results as value by value")
+    {
+        for (size_t size : {1, 7, 8, 2047, 2049, 10'007})
+        {
+            INFO("size: " << size);
+
+            const auto data = make_random_ints(size, INT_MIN, INT_MAX);
+
+            Algorithms::Statistics<int> by_value;
+            for (int x : data)
+                by_value.add(x);
+
+            Algorithms::Statistics<int> bulk;
+            bulk.add(std::span{data});
+
+            Algorithms::Statistics<int> merged;
+            for (size_t i = 0; i < size; i += 1000)
+            {
+                Algorithms::Statistics<int> partial;
+                partial.add(std::span{data}.subspan(i, std::min<size_t>(1000, size - i)));
+                merged.merge(partial);
+            }
+
+            for (const auto& stats : {bulk, merged})
+            {
+                REQUIRE(stats.count() == size);
+                REQUIRE(stats.sum() == std::accumulate(data.begin(), data.end(), int64_t{0}));
+                REQUIRE(stats.mean() == Catch::Approx(by_value.mean()));
+                REQUIRE(stats.variance() == Catch::Approx(population_variance(data)));
+                REQUIRE(stats.min() == *std::min_element(data.begin(), data.end()));
+                REQUIRE(stats.max() == *std::max_element(data.begin(), data.end()));
+            }
+
+            REQUIRE(by_value.variance() == Catch::Approx(population_variance(data)));
+        }
+    }
+}
+
+TEST_CASE("average & partition - single pass statistics + pre-sized outputs")
+{
+    Concurrency::ThreadPool pool{3};
+    const auto par = Algorithms::ParallelPolicy{.pool = &pool, .min_chunk_size = 64};
+
+    const auto data = make_random_ints(10'007);
+
+    auto check = [&data](const auto& policy) {
+        const auto stats = Algorithms::statistics(policy, data.begin(), data.end());
+        const double avg = std::accumulate(data.begin(), data.end(), 0.0) / data.size();
+        REQUIRE(stats.mean() == Catch::Approx(avg));
+
+        // for ints: n <= avg <=> n <= floor(avg)
+        auto [less_equal_than_avg, greater_than_avg] = Algorithms::partition_split(policy, data.begin(), data.end(), Algorithms::less_equal(static_cast<int>(std::floor(stats.mean()))));
+
+        std::vector<int> expected_less_equal, expected_greater;
+        std::partition_copy(data.begin(), data.end(), std::back_inserter(expected_less_equal), std::back_inserter(expected_greater), [avg](int n) { return n <= avg; });
+
+        REQUIRE(less_equal_than_avg == expected_less_equal);
+        REQUIRE(greater_than_avg == expected_greater);
+    };
+
+    SECTION("sequenced")
+    {
+        check(Algorithms::seq);
+    }
+
+    SECTION("parallel")
+    {
+        check(par);
+    }
+}
+
+TEST_CASE("average & partition pipeline - 10^8 ints", "[.][benchmark]")
+{
+    const auto data = make_random_ints(100'000'000);
+
+    auto pipeline = [&data](const auto& policy) {
+        const auto stats = Algorithms::statistics(policy, data.begin(), data.end());
+        auto [less_equal_than_avg, greater_than_avg] = Algorithms::partition_split(policy, data.begin(), data.end(), Algorithms::less_equal(static_cast<int>(std::floor(stats.mean()))));
+
+        return std::pair{less_equal_than_avg.size(), greater_than_avg.size()};
+    };
+
+    BENCHMARK("std::accumulate + std::partition_copy(back_inserter)")
+    {
+        const double avg = std::accumulate(data.begin(), data.end(), 0.0) / data.size();
+
+        std::vector<int> less_equal_than_avg;
+        std::vector<int> greater_than_avg;
+        std::partition_copy(data.begin(), data.end(), std::back_inserter(less_equal_than_avg), std::back_inserter(greater_than_avg), [avg](int n) { return n <= avg; });
+
+        return std::pair{less_equal_than_avg.size(), greater_than_avg.size()};
+    };
+
+    BENCHMARK("Algorithms::statistics + Algorithms::partition_split (seq)")
+    {
+        return pipeline(Algorithms::seq);
+    };
+
+    BENCHMARK("Algorithms::statistics + Algorithms::partition_split (par)")
+    {
+        return pipeline(Algorithms::par);
+    };
+}
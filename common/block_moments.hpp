@@ -0,0 +1,139 @@
+#ifndef BLOCK_MOMENTS_HPP
+#define BLOCK_MOMENTS_HPP
+
+#include "simd_dispatch.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace Numerics
+{
+    template <typename T>
+    using SumType = std::conditional_t<std::is_floating_point_v<T>, double, std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+    // statistics of a block of values - merged into accumulators of whole ranges (Chan's formula)
+    template <typename T>
+    struct Moments
+    {
+        size_t count = 0;
+        SumType<T> sum = 0;
+        double m2 = 0.0; // sum of squared deviations from the mean of the block
+        T min = std::numeric_limits<T>::max();
+        T max = std::numeric_limits<T>::lowest();
+    };
+
+    // blocks fit in L1 cache - 2nd pass over a block (deviations from its mean) does not touch memory
+    constexpr size_t moments_block_size = 2048;
+
+    template <typename T>
+    Moments<T> block_moments_scalar(const T* values, size_t size)
+    {
+        Moments<T> moments{size};
+        for (size_t i = 0; i < size; ++i)
+        {
+            moments.sum += values[i];
+            moments.min = std::min(moments.min, values[i]);
+            moments.max = std::max(moments.max, values[i]);
+        }
+
+        const double mean = static_cast<double>(moments.sum) / static_cast<double>(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            const double deviation = static_cast<double>(values[i]) - mean;
+            moments.m2 += deviation * deviation;
+        }
+
+        return moments;
+    }
+
+#ifdef SIMD_HAS_AVX2_PATH
+    struct NoVectorVisitor
+    {
+        SIMD_TARGET_AVX2 void operator()(__m256i) const
+        {
+        }
+    };
+
+    // visit_vector(__m256i) sees every full vector of 8 values in the 1st pass - extra per-value work
+    // (e.g. a histogram) shares the loop with the moments; the last size % 8 values are not visited
+    template <typename TVectorVisitor = NoVectorVisitor>
+    SIMD_TARGET_AVX2 Moments<int> block_moments_avx2(const int* values, size_t size, TVectorVisitor visit_vector = {})
+    {
+        __m256i sum_low = _mm256_setzero_si256(); // 4 x int64 - sums of 32-bit values do not overflow
+        __m256i sum_high = _mm256_setzero_si256();
+        __m256i min = _mm256_set1_epi32(std::numeric_limits<int>::max());
+        __m256i max = _mm256_set1_epi32(std::numeric_limits<int>::min());
+
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+            sum_low = _mm256_add_epi64(sum_low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(block)));
+            sum_high = _mm256_add_epi64(sum_high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(block, 1)));
+            min = _mm256_min_epi32(min, block);
+            max = _mm256_max_epi32(max, block);
+            visit_vector(block);
+        }
+
+        alignas(32) int64_t sums[4];
+        alignas(32) int mins[8];
+        alignas(32) int maxs[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(sums), _mm256_add_epi64(sum_low, sum_high));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(mins), min);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(maxs), max);
+
+        Moments<int> moments{size, sums[0] + sums[1] + sums[2] + sums[3], 0.0, *std::min_element(mins, mins + 8), *std::max_element(maxs, maxs + 8)};
+        for (; i < size; ++i)
+        {
+            moments.sum += values[i];
+            moments.min = std::min(moments.min, values[i]);
+            moments.max = std::max(moments.max, values[i]);
+        }
+
+        const double mean = static_cast<double>(moments.sum) / static_cast<double>(size);
+
+        const __m256d mean_4 = _mm256_set1_pd(mean);
+        __m256d m2_low = _mm256_setzero_pd();
+        __m256d m2_high = _mm256_setzero_pd();
+
+        i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            const __m256d deviation_low = _mm256_sub_pd(_mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i))), mean_4);
+            const __m256d deviation_high = _mm256_sub_pd(_mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i + 4))), mean_4);
+            m2_low = _mm256_add_pd(m2_low, _mm256_mul_pd(deviation_low, deviation_low));
+            m2_high = _mm256_add_pd(m2_high, _mm256_mul_pd(deviation_high, deviation_high));
+        }
+
+        alignas(32) double m2s[4];
+        _mm256_store_pd(m2s, _mm256_add_pd(m2_low, m2_high));
+        moments.m2 = (m2s[0] + m2s[1]) + (m2s[2] + m2s[3]);
+
+        for (; i < size; ++i)
+        {
+            const double deviation = values[i] - mean;
+            moments.m2 += deviation * deviation;
+        }
+
+        return moments;
+    }
+#endif
+
+    template <typename T>
+    Moments<T> block_moments(const T* values, size_t size)
+    {
+#ifdef SIMD_HAS_AVX2_PATH
+        if constexpr (std::is_same_v<T, int>)
+        {
+            if (Simd::cpu_has_avx2())
+                return block_moments_avx2(values, size);
+        }
+#endif
+        return block_moments_scalar(values, size);
+    }
+}
+
+#endif
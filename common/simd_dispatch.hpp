@@ -0,0 +1,26 @@
+#ifndef SIMD_DISPATCH_HPP
+#define SIMD_DISPATCH_HPP
+
+/////////////////////////////////////////////////////////////////////////////
+// runtime dispatch of AVX2 kernels
+//  - SIMD_HAS_AVX2_PATH - compiler can generate AVX2 code for functions marked SIMD_TARGET_AVX2
+//    (the rest of a program is compiled for the baseline x86-64 ISA)
+//  - Simd::cpu_has_avx2() - kernels are called only when the CPU supports them
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SIMD_HAS_AVX2_PATH 1
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace Simd
+{
+#ifdef SIMD_HAS_AVX2_PATH
+    inline bool cpu_has_avx2()
+    {
+        static const bool has_avx2 = __builtin_cpu_supports("avx2");
+        return has_avx2;
+    }
+#endif
+}
+
+#endif
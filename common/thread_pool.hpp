@@ -0,0 +1,379 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include "unique_function.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Concurrency
+{
+    /////////////////////////////////////////////////////////////////////////////
+    // Chase-Lev work-stealing deque
+    //  - the owner pushes & pops at the bottom (LIFO - hot caches for fork/join)
+    //  - thieves steal from the top (FIFO - the oldest, usually the biggest, tasks)
+    //  - T must be trivially copyable (pointers to tasks)
+    template <typename T>
+    class WorkStealingDeque
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        struct Array
+        {
+            int64_t capacity;
+            std::unique_ptr<std::atomic<T>[]> items;
+
+            explicit Array(int64_t capacity)
+                : capacity{capacity}
+                , items{std::make_unique<std::atomic<T>[]>(capacity)}
+            {
+            }
+
+            T get(int64_t index) const
+            {
+                return items[index & (capacity - 1)].load(std::memory_order_relaxed);
+            }
+
+            void put(int64_t index, T item)
+            {
+                items[index & (capacity - 1)].store(item, std::memory_order_relaxed);
+            }
+        };
+
+        alignas(64) std::atomic<int64_t> top_{0};
+        alignas(64) std::atomic<int64_t> bottom_{0};
+        std::atomic<Array*> array_;
+        std::vector<std::unique_ptr<Array>> arrays_; // old arrays may still be read by thieves - freed with the deque
+
+    public:
+        explicit WorkStealingDeque(int64_t capacity = 1024)
+        {
+            if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+                throw std::invalid_argument("Capacity must be a power of 2");
+
+            arrays_.push_back(std::make_unique<Array>(capacity));
+            array_.store(arrays_.back().get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        // owner only
+        void push(T item)
+        {
+            const int64_t b = bottom_.load(std::memory_order_relaxed);
+            const int64_t t = top_.load(std::memory_order_acquire);
+            Array* array = array_.load(std::memory_order_relaxed);
+
+            if (b - t > array->capacity - 1)
+                array = grow(array, t, b);
+
+            array->put(b, item);
+            bottom_.store(b + 1, std::memory_order_release);
+        }
+
+        // owner only
+        std::optional<T> pop()
+        {
+            const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+            Array* array = array_.load(std::memory_order_relaxed);
+            bottom_.store(b, std::memory_order_seq_cst);
+            int64_t t = top_.load(std::memory_order_seq_cst);
+
+            if (t > b) // empty
+            {
+                bottom_.store(b + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            T item = array->get(b);
+
+            if (t == b) // the last item - race with thieves
+            {
+                const bool is_won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom_.store(b + 1, std::memory_order_relaxed);
+
+                if (!is_won)
+                    return std::nullopt;
+            }
+
+            return item;
+        }
+
+        // any thread
+        std::optional<T> steal()
+        {
+            int64_t t = top_.load(std::memory_order_seq_cst);
+            const int64_t b = bottom_.load(std::memory_order_seq_cst);
+
+            if (t >= b)
+                return std::nullopt;
+
+            Array* array = array_.load(std::memory_order_acquire);
+            T item = array->get(t);
+
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return std::nullopt; // lost the race
+
+            return item;
+        }
+
+        bool empty() const
+        {
+            return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        Array* grow(Array* array, int64_t t, int64_t b)
+        {
+            auto bigger = std::make_unique<Array>(array->capacity * 2);
+            for (int64_t i = t; i < b; ++i)
+                bigger->put(i, array->get(i));
+
+            arrays_.push_back(std::move(bigger));
+            array_.store(arrays_.back().get(), std::memory_order_release);
+
+            return arrays_.back().get();
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // ThreadPool - work-stealing executor
+    //  - tasks submitted by a worker go to its own deque, other threads use the injection queue
+    //  - an idle worker steals from a random victim before going to sleep
+    //  - destructor (or shutdown()) drains all submitted tasks before joining workers
+    class ThreadPool
+    {
+    public:
+        using Task = unique_function<void()>;
+
+    private:
+        struct Worker
+        {
+            WorkStealingDeque<Task*> deque;
+            std::thread thread;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers_;
+
+        std::mutex mtx_injection_;
+        std::deque<Task*> injection_queue_;
+
+        std::mutex mtx_sleep_;
+        std::condition_variable cv_sleep_;
+        std::atomic<size_t> sleepers_{0};
+
+        alignas(64) std::atomic<size_t> pending_{0}; // submitted but not yet taken
+        std::atomic<bool> is_stopping_{false};
+
+        struct WorkerContext
+        {
+            ThreadPool* pool = nullptr;
+            size_t index = 0;
+            uint64_t rnd = 0x9E3779B97F4A7C15ull;
+        };
+
+        static WorkerContext& this_worker()
+        {
+            thread_local WorkerContext context;
+            return context;
+        }
+
+    public:
+        explicit ThreadPool(size_t size = std::max(1u, std::thread::hardware_concurrency()))
+        {
+            for (size_t i = 0; i < size; ++i)
+                workers_.push_back(std::make_unique<Worker>());
+
+            for (size_t i = 0; i < size; ++i)
+                workers_[i]->thread = std::thread{[this, i] { worker_loop(i); }};
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool()
+        {
+            shutdown();
+        }
+
+        size_t size() const
+        {
+            return workers_.size();
+        }
+
+        template <typename TTask>
+        void post(TTask&& task)
+        {
+            push_task(new Task(std::forward<TTask>(task)));
+        }
+
+        template <typename F>
+        auto submit(F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+        {
+            using TResult = std::invoke_result_t<std::decay_t<F>>;
+
+            std::packaged_task<TResult()> task{std::forward<F>(f)};
+            auto result = task.get_future();
+
+            push_task(new Task(std::move(task)));
+
+            return result;
+        }
+
+        // runs other tasks while waiting - a worker can wait for its subtasks without deadlock
+        template <typename T>
+        T wait(std::future<T>& result)
+        {
+            while (result.wait_for(std::chrono::seconds::zero()) != std::future_status::ready)
+            {
+                if (!try_run_one())
+                    std::this_thread::yield();
+            }
+
+            return result.get();
+        }
+
+        // waits until all submitted tasks are done & stops workers
+        void shutdown()
+        {
+            if (is_stopping_.exchange(true))
+                return;
+
+            {
+                std::lock_guard lk{mtx_sleep_};
+            }
+            cv_sleep_.notify_all();
+
+            for (auto& worker : workers_)
+                worker->thread.join();
+        }
+
+    private:
+        bool is_worker_thread() const
+        {
+            return this_worker().pool == this;
+        }
+
+        void push_task(Task* task)
+        {
+            const bool is_worker = is_worker_thread();
+
+            if (!is_worker && is_stopping_.load(std::memory_order_relaxed))
+            {
+                delete task;
+                throw std::runtime_error("ThreadPool is stopped");
+            }
+
+            pending_.fetch_add(1, std::memory_order_seq_cst); // before push - pending_ never underflows
+
+            if (is_worker)
+            {
+                workers_[this_worker().index]->deque.push(task);
+            }
+            else
+            {
+                std::lock_guard lk{mtx_injection_};
+                injection_queue_.push_back(task);
+            }
+
+            if (sleepers_.load(std::memory_order_seq_cst) > 0)
+            {
+                std::lock_guard lk{mtx_sleep_};
+                cv_sleep_.notify_one();
+            }
+        }
+
+        Task* take_task()
+        {
+            auto& context = this_worker();
+
+            if (context.pool == this)
+            {
+                if (auto task = workers_[context.index]->deque.pop())
+                    return *task;
+            }
+
+            {
+                std::lock_guard lk{mtx_injection_};
+                if (!injection_queue_.empty())
+                {
+                    Task* task = injection_queue_.front();
+                    injection_queue_.pop_front();
+                    return task;
+                }
+            }
+
+            // xorshift - start stealing from a random victim
+            context.rnd ^= context.rnd << 13;
+            context.rnd ^= context.rnd >> 7;
+            context.rnd ^= context.rnd << 17;
+
+            const size_t start = context.rnd % workers_.size();
+            for (size_t i = 0; i < workers_.size(); ++i)
+            {
+                const size_t victim = (start + i) % workers_.size();
+                if (context.pool == this && victim == context.index)
+                    continue;
+
+                if (auto task = workers_[victim]->deque.steal())
+                    return *task;
+            }
+
+            return nullptr;
+        }
+
+        bool try_run_one()
+        {
+            Task* task = take_task();
+            if (!task)
+                return false;
+
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+
+            std::unique_ptr<Task> owned_task{task};
+            (*owned_task)();
+
+            return true;
+        }
+
+        void worker_loop(size_t index)
+        {
+            this_worker().pool = this;
+            this_worker().index = index;
+            this_worker().rnd += index;
+
+            for (;;)
+            {
+                if (try_run_one())
+                    continue;
+
+                std::unique_lock lk{mtx_sleep_};
+                sleepers_.fetch_add(1, std::memory_order_seq_cst);
+
+                cv_sleep_.wait(lk, [this] {
+                    return pending_.load(std::memory_order_seq_cst) > 0 || is_stopping_.load();
+                });
+
+                sleepers_.fetch_sub(1, std::memory_order_relaxed);
+
+                if (is_stopping_.load() && pending_.load(std::memory_order_seq_cst) == 0)
+                    return;
+            }
+        }
+    };
+}
+
+#endif
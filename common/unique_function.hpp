@@ -0,0 +1,182 @@
+#ifndef UNIQUE_FUNCTION_HPP
+#define UNIQUE_FUNCTION_HPP
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////
+// unique_function - move-only std::function
+//  - accepts move-only callables (e.g. lambdas capturing unique_ptr)
+//  - callables up to BufferSize bytes are stored inline (no allocation)
+//  - type erasure via a static table of function pointers - no RTTI, no virtual functions
+template <typename TSignature, size_t BufferSize = 64>
+class unique_function;
+
+template <typename R, typename... TArgs, size_t BufferSize>
+class unique_function<R(TArgs...), BufferSize>
+{
+    struct VTable
+    {
+        R (*invoke)(void* storage, TArgs&&... args);
+        void (*move_to)(void* src, void* dest) noexcept; // move-constructs into dest & destroys src
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template <typename F>
+    static constexpr bool is_stored_inline = sizeof(F) <= BufferSize
+        && alignof(F) <= alignof(std::max_align_t)
+        && std::is_nothrow_move_constructible_v<F>;
+
+    // std::invoke_r is C++23 - result of a callable is discarded for R = void (like std::function<void()>)
+    template <typename F>
+    static R invoke_r(F& f, TArgs&&... args)
+    {
+        if constexpr (std::is_void_v<R>)
+            std::invoke(f, std::forward<TArgs>(args)...);
+        else
+            return std::invoke(f, std::forward<TArgs>(args)...);
+    }
+
+    // null function & member pointers and empty std::functions make an empty unique_function
+    template <typename F>
+    static bool is_null(const F& f) noexcept
+    {
+        if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            return f == nullptr;
+        else
+            return false;
+    }
+
+    template <typename TOtherSignature>
+    static bool is_null(const std::function<TOtherSignature>& f) noexcept
+    {
+        return !f;
+    }
+
+    template <typename F>
+    struct InlineStorage
+    {
+        static F& get(void* storage) noexcept
+        {
+            return *std::launder(static_cast<F*>(storage));
+        }
+
+        static constexpr VTable vtable{
+            [](void* storage, TArgs&&... args) -> R { return invoke_r(get(storage), std::forward<TArgs>(args)...); },
+            [](void* src, void* dest) noexcept {
+                ::new (dest) F(std::move(get(src)));
+                get(src).~F();
+            },
+            [](void* storage) noexcept { get(storage).~F(); }};
+    };
+
+    template <typename F>
+    struct HeapStorage
+    {
+        static F*& get(void* storage) noexcept
+        {
+            return *std::launder(static_cast<F**>(storage));
+        }
+
+        static constexpr VTable vtable{
+            [](void* storage, TArgs&&... args) -> R { return invoke_r(*get(storage), std::forward<TArgs>(args)...); },
+            [](void* src, void* dest) noexcept { ::new (dest) F*(get(src)); },
+            [](void* storage) noexcept { delete get(storage); }};
+    };
+
+    alignas(std::max_align_t) std::byte storage_[BufferSize];
+    const VTable* vtable_ = nullptr;
+
+public:
+    static_assert(BufferSize >= sizeof(void*));
+
+    unique_function() noexcept = default;
+
+    unique_function(std::nullptr_t) noexcept
+    {
+    }
+
+    template <typename F, typename TFunction = std::decay_t<F>>
+        requires(!std::is_same_v<TFunction, unique_function> && std::is_invocable_r_v<R, TFunction&, TArgs...>)
+    unique_function(F&& f)
+    {
+        if (is_null(f))
+            return;
+
+        if constexpr (is_stored_inline<TFunction>)
+        {
+            ::new (static_cast<void*>(storage_)) TFunction(std::forward<F>(f));
+            vtable_ = &InlineStorage<TFunction>::vtable;
+        }
+        else
+        {
+            ::new (static_cast<void*>(storage_)) TFunction*(new TFunction(std::forward<F>(f)));
+            vtable_ = &HeapStorage<TFunction>::vtable;
+        }
+    }
+
+    unique_function(unique_function&& other) noexcept
+        : vtable_{std::exchange(other.vtable_, nullptr)}
+    {
+        if (vtable_)
+            vtable_->move_to(other.storage_, storage_);
+    }
+
+    unique_function& operator=(unique_function&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+
+            vtable_ = std::exchange(other.vtable_, nullptr);
+            if (vtable_)
+                vtable_->move_to(other.storage_, storage_);
+        }
+
+        return *this;
+    }
+
+    unique_function& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    unique_function(const unique_function&) = delete;
+    unique_function& operator=(const unique_function&) = delete;
+
+    ~unique_function()
+    {
+        reset();
+    }
+
+    R operator()(TArgs... args)
+    {
+        if (!vtable_)
+            throw std::bad_function_call{};
+
+        return vtable_->invoke(storage_, std::forward<TArgs>(args)...);
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return vtable_ != nullptr;
+    }
+
+    void swap(unique_function& other) noexcept
+    {
+        std::swap(*this, other);
+    }
+
+private:
+    void reset() noexcept
+    {
+        if (vtable_)
+            std::exchange(vtable_, nullptr)->destroy(storage_);
+    }
+};
+
+#endif
@@ -0,0 +1,336 @@
+#ifndef BINARY_IO_HPP
+#define BINARY_IO_HPP
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace Serialization
+{
+    // types written with a fixed width in little-endian byte order
+    template <typename T>
+    concept Scalar = (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+    // max length of a varint of 64-bit value - 7 bits per byte
+    inline constexpr size_t max_varint_size = 10;
+
+    template <std::unsigned_integral T>
+    constexpr T byteswap(T value) noexcept
+    {
+        T result = 0;
+        for (size_t i = 0; i < sizeof(T); ++i)
+        {
+            result = static_cast<T>((result << 8) | (value & 0xFF));
+            value = static_cast<T>(value >> 8);
+        }
+        return result;
+    }
+
+    // small negative numbers -> small unsigned numbers: 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...
+    template <std::signed_integral T>
+    constexpr std::make_unsigned_t<T> zigzag_encode(T value) noexcept
+    {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<U>(static_cast<U>(value) << 1) ^ static_cast<U>(value >> std::numeric_limits<T>::digits);
+    }
+
+    template <std::unsigned_integral U>
+    constexpr std::make_signed_t<U> zigzag_decode(U value) noexcept
+    {
+        return static_cast<std::make_signed_t<U>>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    template <std::unsigned_integral T>
+    constexpr size_t varint_size(T value) noexcept
+    {
+        return (static_cast<size_t>(std::bit_width(value | 1u)) + 6) / 7;
+    }
+
+    namespace Details
+    {
+        template <size_t Size>
+        struct UnsignedOfSize;
+
+        template <>
+        struct UnsignedOfSize<1>
+        {
+            using type = uint8_t;
+        };
+
+        template <>
+        struct UnsignedOfSize<2>
+        {
+            using type = uint16_t;
+        };
+
+        template <>
+        struct UnsignedOfSize<4>
+        {
+            using type = uint32_t;
+        };
+
+        template <>
+        struct UnsignedOfSize<8>
+        {
+            using type = uint64_t;
+        };
+
+        template <typename T>
+        using Bits = typename UnsignedOfSize<sizeof(T)>::type;
+
+        // wire format is little-endian - on little-endian machines items are copied as they are in memory
+        inline constexpr bool is_native_wire_order = std::endian::native == std::endian::little;
+
+        template <Scalar T>
+        void store(std::byte* dest, T value) noexcept
+        {
+            auto bits = std::bit_cast<Bits<T>>(value);
+            if constexpr (!is_native_wire_order)
+                bits = byteswap(bits);
+            std::memcpy(dest, &bits, sizeof(bits));
+        }
+
+        template <Scalar T>
+        T load(const std::byte* src) noexcept
+        {
+            Bits<T> bits;
+            std::memcpy(&bits, src, sizeof(bits));
+            if constexpr (!is_native_wire_order)
+                bits = byteswap(bits);
+
+            if constexpr (std::is_same_v<T, bool>)
+                return bits != 0; // not every byte is a valid bool
+            else
+                return std::bit_cast<T>(bits);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // BinaryWriter - serialization into a caller-provided buffer (no allocations)
+    //  - scalars: fixed width, little-endian; arrays of scalars: one memcpy on little-endian machines
+    //  - integers as varints (LEB128, signed - zigzag) & strings with a varint length prefix
+    //  - throws std::out_of_range when the buffer is too small
+    class BinaryWriter
+    {
+        std::span<std::byte> buffer_;
+        size_t position_ = 0;
+
+        std::byte* claim(size_t size)
+        {
+            if (size > buffer_.size() - position_)
+                throw std::out_of_range("BinaryWriter - buffer too small");
+
+            std::byte* dest = buffer_.data() + position_;
+            position_ += size;
+            return dest;
+        }
+
+    public:
+        explicit BinaryWriter(std::span<std::byte> buffer)
+            : buffer_{buffer}
+        {
+        }
+
+        size_t position() const
+        {
+            return position_;
+        }
+
+        size_t remaining() const
+        {
+            return buffer_.size() - position_;
+        }
+
+        std::span<const std::byte> written() const
+        {
+            return buffer_.first(position_);
+        }
+
+        template <Scalar T>
+        void write(T value)
+        {
+            Details::store(claim(sizeof(T)), value);
+        }
+
+        // items without size prefix
+        template <Scalar T>
+        void write_array(std::span<const T> values)
+        {
+            std::byte* dest = claim(values.size_bytes());
+
+            if constexpr (Details::is_native_wire_order)
+            {
+                if (!values.empty())
+                    std::memcpy(dest, values.data(), values.size_bytes());
+            }
+            else
+            {
+                for (const T& value : values)
+                {
+                    Details::store(dest, value);
+                    dest += sizeof(T);
+                }
+            }
+        }
+
+        void write_bytes(std::span<const std::byte> bytes)
+        {
+            std::byte* dest = claim(bytes.size());
+            if (!bytes.empty())
+                std::memcpy(dest, bytes.data(), bytes.size());
+        }
+
+        template <std::unsigned_integral T>
+        void write_varint(T value)
+        {
+            std::byte* dest = claim(varint_size(value));
+
+            while (value >= 0x80)
+            {
+                *dest++ = static_cast<std::byte>(value | 0x80);
+                value >>= 7;
+            }
+            *dest = static_cast<std::byte>(value);
+        }
+
+        template <std::signed_integral T>
+        void write_varint(T value)
+        {
+            write_varint(zigzag_encode(value));
+        }
+
+        void write_string(std::string_view text)
+        {
+            write_varint(text.size());
+            write_bytes(std::as_bytes(std::span{text}));
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // BinaryReader - deserialization of data written by BinaryWriter
+    //  - read_bytes/read_string return views of the buffer (zero-copy)
+    //  - every read is bounds-checked - throws std::out_of_range for truncated data & too long varints
+    class BinaryReader
+    {
+        std::span<const std::byte> buffer_;
+        size_t position_ = 0;
+
+        const std::byte* consume(size_t size)
+        {
+            if (size > remaining())
+                throw std::out_of_range("BinaryReader - unexpected end of data");
+
+            const std::byte* src = buffer_.data() + position_;
+            position_ += size;
+            return src;
+        }
+
+        static void throw_varint_overflow()
+        {
+            throw std::out_of_range("BinaryReader - varint does not fit into the type");
+        }
+
+    public:
+        explicit BinaryReader(std::span<const std::byte> buffer)
+            : buffer_{buffer}
+        {
+        }
+
+        size_t position() const
+        {
+            return position_;
+        }
+
+        size_t remaining() const
+        {
+            return buffer_.size() - position_;
+        }
+
+        template <Scalar T>
+        T read()
+        {
+            return Details::load<T>(consume(sizeof(T)));
+        }
+
+        template <Scalar T>
+        void read_array(std::span<T> values)
+        {
+            const std::byte* src = consume(values.size_bytes());
+
+            if constexpr (Details::is_native_wire_order && !std::is_same_v<T, bool>)
+            {
+                if (!values.empty())
+                    std::memcpy(values.data(), src, values.size_bytes());
+            }
+            else
+            {
+                for (T& value : values)
+                {
+                    value = Details::load<T>(src);
+                    src += sizeof(T);
+                }
+            }
+        }
+
+        std::span<const std::byte> read_bytes(size_t size)
+        {
+            return {consume(size), size};
+        }
+
+        template <std::unsigned_integral T>
+        T read_varint()
+        {
+            const std::byte* src = buffer_.data() + position_;
+            // with max_varint_size bytes left, bounds are checked once for the whole varint
+            const size_t available = remaining() >= max_varint_size ? max_varint_size : remaining();
+
+            uint64_t value = 0;
+            for (size_t i = 0; i < available; ++i)
+            {
+                const auto byte = std::to_integer<uint64_t>(src[i]);
+                const unsigned shift = 7 * static_cast<unsigned>(i);
+
+                if (i == max_varint_size - 1 && byte > 1) // only the top bit of uint64_t is left
+                    throw_varint_overflow();
+
+                value |= (byte & 0x7F) << shift;
+
+                if ((byte & 0x80) == 0)
+                {
+                    if (value > std::numeric_limits<T>::max())
+                        throw_varint_overflow();
+
+                    position_ += i + 1;
+                    return static_cast<T>(value);
+                }
+            }
+
+            if (available == max_varint_size)
+                throw_varint_overflow();
+            throw std::out_of_range("BinaryReader - unexpected end of data");
+        }
+
+        template <std::signed_integral T>
+        T read_varint()
+        {
+            return zigzag_decode(read_varint<std::make_unsigned_t<T>>());
+        }
+
+        std::string_view read_string()
+        {
+            const auto size = read_varint<size_t>();
+            const std::byte* src = consume(size);
+            return {reinterpret_cast<const char*>(src), size};
+        }
+    };
+}
+
+#endif
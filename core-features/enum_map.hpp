@@ -0,0 +1,304 @@
+#ifndef ENUM_MAP_HPP
+#define ENUM_MAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace Enums
+{
+    /////////////////////////////////////////////////////////////////////////////
+    // enum_range - values scanned for enumerators at compile time
+    //  - default: [-128, 127] clipped to the range of the underlying type
+    //  - specialize for enums with values outside of the default range:
+    //      template <> struct Enums::enum_range<State> { static constexpr int min = 0; static constexpr int max = 665; };
+    template <typename E>
+    struct enum_range
+    {
+        static constexpr int min = std::max<int64_t>(-128, std::numeric_limits<std::underlying_type_t<E>>::min());
+        static constexpr int max = std::min<int64_t>(127, std::numeric_limits<std::underlying_type_t<E>>::max());
+    };
+
+    namespace Details
+    {
+        // compiler prints the value of V in the signature - "Coffee::americano" or "(Coffee)4"
+        template <auto V>
+        constexpr std::string_view value_text()
+        {
+#if defined(__clang__) || defined(__GNUC__)
+            const std::string_view signature = __PRETTY_FUNCTION__;
+            const size_t start = signature.find("V = ") + 4;
+            return signature.substr(start, signature.find_first_of(";]", start) - start);
+#elif defined(_MSC_VER)
+            const std::string_view signature = __FUNCSIG__;
+            const size_t end = signature.rfind(">(void)");
+            const size_t start = signature.rfind('<', end) + 1;
+            return signature.substr(start, end - start);
+#else
+            return {};
+#endif
+        }
+
+        // "Coffee::americano" -> "americano", "(Coffee)4" -> "" (not an enumerator)
+        constexpr std::string_view enumerator_name(std::string_view text)
+        {
+            if (text.empty() || text.find('(') != std::string_view::npos)
+                return {};
+
+            const size_t last_colon = text.rfind(':');
+            const std::string_view name = last_colon == std::string_view::npos ? text : text.substr(last_colon + 1);
+
+            const char first = name.empty() ? '0' : name.front();
+            const bool is_identifier = first == '_' || (first >= 'a' && first <= 'z') || (first >= 'A' && first <= 'Z');
+
+            return is_identifier ? name : std::string_view{};
+        }
+
+        template <typename E>
+        constexpr size_t range_size = static_cast<size_t>(enum_range<E>::max - enum_range<E>::min + 1);
+
+        // names of all values in enum_range - empty for values that are not enumerators
+        template <typename E>
+        constexpr auto names_in_range = []<int... Is>(std::integer_sequence<int, Is...>) {
+            return std::array<std::string_view, sizeof...(Is)>{enumerator_name(value_text<static_cast<E>(enum_range<E>::min + Is)>())...};
+        }(std::make_integer_sequence<int, range_size<E>>{});
+    }
+
+    template <typename E>
+    inline constexpr size_t enum_count = std::ranges::count_if(Details::names_in_range<E>, [](std::string_view name) { return !name.empty(); });
+
+    // enumerators in order of their values
+    template <typename E>
+    inline constexpr auto enum_values = [] {
+        std::array<E, enum_count<E>> values{};
+        size_t index = 0;
+        for (size_t i = 0; i < Details::range_size<E>; ++i)
+            if (!Details::names_in_range<E>[i].empty())
+                values[index++] = static_cast<E>(enum_range<E>::min + static_cast<int>(i));
+        return values;
+    }();
+
+    template <typename E>
+    inline constexpr auto enum_names = [] {
+        std::array<std::string_view, enum_count<E>> names{};
+        std::ranges::copy_if(Details::names_in_range<E>, names.begin(), [](std::string_view name) { return !name.empty(); });
+        return names;
+    }();
+
+    namespace Details
+    {
+        template <typename E>
+        constexpr bool is_contiguous = enum_count<E> != 0
+            && static_cast<int64_t>(enum_values<E>.back()) - static_cast<int64_t>(enum_values<E>.front()) + 1 == static_cast<int64_t>(enum_count<E>);
+
+        template <typename E>
+        using DenseIndex = std::conditional_t<(enum_count<E> < UINT8_MAX), uint8_t, uint16_t>;
+
+        template <typename E>
+        constexpr DenseIndex<E> no_index = std::numeric_limits<DenseIndex<E>>::max();
+
+        // value - enum_range<E>::min -> position of the enumerator in enum_values (only for enums with gaps)
+        template <typename E>
+        constexpr auto dense_indexes = [] {
+            std::array<DenseIndex<E>, range_size<E>> indexes{};
+            DenseIndex<E> next = 0;
+            for (size_t i = 0; i < range_size<E>; ++i)
+                indexes[i] = names_in_range<E>[i].empty() ? no_index<E> : next++;
+            return indexes;
+        }();
+    }
+
+    // position of the enumerator in enum_values - nullopt for values that are not enumerators
+    template <typename E>
+    constexpr std::optional<size_t> enum_index(E value)
+    {
+        const auto underlying = static_cast<int64_t>(static_cast<std::underlying_type_t<E>>(value));
+
+        if constexpr (Details::is_contiguous<E>)
+        {
+            const int64_t index = underlying - static_cast<int64_t>(enum_values<E>.front());
+            if (index < 0 || index >= static_cast<int64_t>(enum_count<E>))
+                return std::nullopt;
+            return static_cast<size_t>(index);
+        }
+        else
+        {
+            const int64_t offset = underlying - enum_range<E>::min;
+            if (offset < 0 || offset >= static_cast<int64_t>(Details::range_size<E>))
+                return std::nullopt;
+
+            const auto index = Details::dense_indexes<E>[static_cast<size_t>(offset)];
+            if (index == Details::no_index<E>)
+                return std::nullopt;
+            return index;
+        }
+    }
+
+    // "" for values that are not enumerators
+    template <typename E>
+    constexpr std::string_view enum_name(E value)
+    {
+        const auto index = enum_index(value);
+        return index ? enum_names<E>[*index] : std::string_view{};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // enum_map - value for every enumerator of E stored in std::array
+    //  - size is the number of enumerators (not the range of values) - gaps (e.g. americano = 10) take no space
+    //  - O(1) access - offset of a contiguous enum or one byte of a static index table for enums with gaps
+    //  - iteration in order of enum values: for (auto [key, value] : map)
+    template <typename E, typename T>
+    class enum_map
+    {
+        static_assert(std::is_enum_v<E>, "enum_map requires an enum type");
+        static_assert(enum_count<E> > 0, "no enumerators found - specialize Enums::enum_range<E>");
+
+        std::array<T, enum_count<E>> values_{};
+
+        template <bool IsConst>
+        class Iterator
+        {
+            using Map = std::conditional_t<IsConst, const enum_map, enum_map>;
+
+            Map* map_;
+            size_t index_;
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::pair<E, T>;
+            using reference = std::pair<E, std::conditional_t<IsConst, const T&, T&>>;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr Iterator(Map& map, size_t index)
+                : map_{&map}
+                , index_{index}
+            {
+            }
+
+            constexpr reference operator*() const
+            {
+                return reference{enum_values<E>[index_], map_->values_[index_]};
+            }
+
+            constexpr Iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            constexpr Iterator operator++(int)
+            {
+                Iterator it = *this;
+                ++index_;
+                return it;
+            }
+
+            constexpr bool operator==(const Iterator& other) const
+            {
+                return index_ == other.index_;
+            }
+        };
+
+    public:
+        using key_type = E;
+        using mapped_type = T;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        constexpr enum_map() = default;
+
+        // enumerators missing in items get T{}
+        constexpr enum_map(std::initializer_list<std::pair<E, T>> items)
+        {
+            for (const auto& [key, value] : items)
+                at(key) = value;
+        }
+
+        static constexpr size_t size()
+        {
+            return enum_count<E>;
+        }
+
+        // precondition: key is an enumerator of E
+        constexpr T& operator[](E key)
+        {
+            return values_[unchecked_index(key)];
+        }
+
+        constexpr const T& operator[](E key) const
+        {
+            return values_[unchecked_index(key)];
+        }
+
+        constexpr T& at(E key)
+        {
+            return values_[checked_index(key)];
+        }
+
+        constexpr const T& at(E key) const
+        {
+            return values_[checked_index(key)];
+        }
+
+        constexpr std::span<T, enum_count<E>> values()
+        {
+            return values_;
+        }
+
+        constexpr std::span<const T, enum_count<E>> values() const
+        {
+            return values_;
+        }
+
+        constexpr iterator begin()
+        {
+            return iterator{*this, 0};
+        }
+
+        constexpr iterator end()
+        {
+            return iterator{*this, size()};
+        }
+
+        constexpr const_iterator begin() const
+        {
+            return const_iterator{*this, 0};
+        }
+
+        constexpr const_iterator end() const
+        {
+            return const_iterator{*this, size()};
+        }
+
+    private:
+        static constexpr size_t unchecked_index(E key)
+        {
+            const auto underlying = static_cast<int64_t>(static_cast<std::underlying_type_t<E>>(key));
+
+            if constexpr (Details::is_contiguous<E>)
+                return static_cast<size_t>(underlying - static_cast<int64_t>(enum_values<E>.front()));
+            else
+                return Details::dense_indexes<E>[static_cast<size_t>(underlying - enum_range<E>::min)];
+        }
+
+        static constexpr size_t checked_index(E key)
+        {
+            const auto index = enum_index(key);
+            if (!index)
+                throw std::out_of_range("enum_map - value is not an enumerator");
+            return *index;
+        }
+    };
+}
+
+#endif
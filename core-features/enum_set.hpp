@@ -0,0 +1,253 @@
+#ifndef ENUM_SET_HPP
+#define ENUM_SET_HPP
+
+#include "enum_map.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+
+namespace Enums
+{
+    /////////////////////////////////////////////////////////////////////////////
+    // enum_set - set of enumerators stored as bits (one bit per enumerator - see enum_index)
+    //  - union/intersection/difference are a few word-wide bitwise ops
+    //  - size() - popcount, iteration - countr_zero (in order of enum values)
+    template <typename E>
+    class enum_set
+    {
+        static_assert(std::is_enum_v<E>, "enum_set requires an enum type");
+        static_assert(enum_count<E> > 0, "no enumerators found - specialize Enums::enum_range<E>");
+
+        static constexpr size_t bits_per_word = 64;
+        static constexpr size_t no_of_words = (enum_count<E> + bits_per_word - 1) / bits_per_word;
+
+        // bits above enum_count<E> are always zero
+        std::array<uint64_t, no_of_words> words_{};
+
+        // index of the first set bit not less than from - enum_count<E> if none
+        constexpr size_t next_index(size_t from) const
+        {
+            size_t word = from / bits_per_word;
+            if (word >= no_of_words)
+                return enum_count<E>;
+
+            uint64_t bits = words_[word] & (~uint64_t{0} << (from % bits_per_word));
+            while (bits == 0)
+            {
+                if (++word == no_of_words)
+                    return enum_count<E>;
+                bits = words_[word];
+            }
+
+            return word * bits_per_word + static_cast<size_t>(std::countr_zero(bits));
+        }
+
+        static constexpr size_t checked_index(E value)
+        {
+            const auto index = enum_index(value);
+            if (!index)
+                throw std::out_of_range("enum_set - value is not an enumerator");
+            return *index;
+        }
+
+        static constexpr uint64_t bit(size_t index)
+        {
+            return uint64_t{1} << (index % bits_per_word);
+        }
+
+    public:
+        class iterator
+        {
+            const enum_set* set_ = nullptr;
+            size_t index_ = 0;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = E;
+            using reference = E;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr iterator() = default;
+
+            constexpr iterator(const enum_set& set, size_t index)
+                : set_{&set}
+                , index_{index}
+            {
+            }
+
+            constexpr E operator*() const
+            {
+                return enum_values<E>[index_];
+            }
+
+            constexpr iterator& operator++()
+            {
+                index_ = set_->next_index(index_ + 1);
+                return *this;
+            }
+
+            constexpr iterator operator++(int)
+            {
+                iterator it = *this;
+                ++*this;
+                return it;
+            }
+
+            constexpr bool operator==(const iterator& other) const
+            {
+                return index_ == other.index_;
+            }
+        };
+
+        using const_iterator = iterator;
+
+        constexpr enum_set() = default;
+
+        constexpr enum_set(std::initializer_list<E> values)
+        {
+            for (E value : values)
+                insert(value);
+        }
+
+        static constexpr enum_set all()
+        {
+            return ~enum_set{};
+        }
+
+        static constexpr size_t max_size()
+        {
+            return enum_count<E>;
+        }
+
+        constexpr size_t size() const
+        {
+            size_t count = 0;
+            for (uint64_t word : words_)
+                count += static_cast<size_t>(std::popcount(word));
+            return count;
+        }
+
+        constexpr bool empty() const
+        {
+            for (uint64_t word : words_)
+                if (word != 0)
+                    return false;
+            return true;
+        }
+
+        // false for values that are not enumerators
+        constexpr bool contains(E value) const
+        {
+            const auto index = enum_index(value);
+            return index && (words_[*index / bits_per_word] & bit(*index)) != 0;
+        }
+
+        // throws std::out_of_range for values that are not enumerators
+        constexpr void insert(E value)
+        {
+            const size_t index = checked_index(value);
+            words_[index / bits_per_word] |= bit(index);
+        }
+
+        constexpr void erase(E value)
+        {
+            if (const auto index = enum_index(value))
+                words_[*index / bits_per_word] &= ~bit(*index);
+        }
+
+        constexpr void clear()
+        {
+            words_ = {};
+        }
+
+        constexpr iterator begin() const
+        {
+            return iterator{*this, next_index(0)};
+        }
+
+        constexpr iterator end() const
+        {
+            return iterator{*this, enum_count<E>};
+        }
+
+        constexpr enum_set& operator|=(const enum_set& other)
+        {
+            for (size_t i = 0; i < no_of_words; ++i)
+                words_[i] |= other.words_[i];
+            return *this;
+        }
+
+        constexpr enum_set& operator&=(const enum_set& other)
+        {
+            for (size_t i = 0; i < no_of_words; ++i)
+                words_[i] &= other.words_[i];
+            return *this;
+        }
+
+        constexpr enum_set& operator-=(const enum_set& other)
+        {
+            for (size_t i = 0; i < no_of_words; ++i)
+                words_[i] &= ~other.words_[i];
+            return *this;
+        }
+
+        constexpr enum_set& operator^=(const enum_set& other)
+        {
+            for (size_t i = 0; i < no_of_words; ++i)
+                words_[i] ^= other.words_[i];
+            return *this;
+        }
+
+        // complement within enumerators of E
+        constexpr enum_set operator~() const
+        {
+            enum_set result;
+            for (size_t i = 0; i < no_of_words; ++i)
+                result.words_[i] = ~words_[i];
+
+            if constexpr (enum_count<E> % bits_per_word != 0)
+                result.words_.back() &= (uint64_t{1} << (enum_count<E> % bits_per_word)) - 1;
+
+            return result;
+        }
+
+        friend constexpr enum_set operator|(enum_set lhs, const enum_set& rhs)
+        {
+            return lhs |= rhs;
+        }
+
+        friend constexpr enum_set operator&(enum_set lhs, const enum_set& rhs)
+        {
+            return lhs &= rhs;
+        }
+
+        friend constexpr enum_set operator-(enum_set lhs, const enum_set& rhs)
+        {
+            return lhs -= rhs;
+        }
+
+        friend constexpr enum_set operator^(enum_set lhs, const enum_set& rhs)
+        {
+            return lhs ^= rhs;
+        }
+
+        constexpr bool is_subset_of(const enum_set& other) const
+        {
+            return (*this - other).empty();
+        }
+
+        constexpr bool intersects(const enum_set& other) const
+        {
+            return !(*this & other).empty();
+        }
+
+        friend constexpr bool operator==(const enum_set&, const enum_set&) = default;
+    };
+}
+
+#endif
@@ -0,0 +1,254 @@
+#ifndef FLOAT_BITS_HPP
+#define FLOAT_BITS_HPP
+
+#include "simd_dispatch.hpp"
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+
+namespace FloatBits
+{
+    /////////////////////////////////////////////////////////////////////////////
+    // IEEE-754 layout - operations on the integer image of a value (std::bit_cast)
+    //  - the same results on little & big-endian machines (unlike poking bytes of std::as_writable_bytes)
+    template <std::floating_point T>
+    struct Layout;
+
+    template <>
+    struct Layout<float>
+    {
+        using Bits = uint32_t;
+        static constexpr int mantissa_bits = 23;
+        static constexpr int exponent_bits = 8;
+    };
+
+    template <>
+    struct Layout<double>
+    {
+        using Bits = uint64_t;
+        static constexpr int mantissa_bits = 52;
+        static constexpr int exponent_bits = 11;
+    };
+
+    template <typename T>
+    concept IEEE754 = std::same_as<T, float> || std::same_as<T, double>;
+
+    template <IEEE754 T>
+    using Bits = typename Layout<T>::Bits;
+
+    template <IEEE754 T>
+    inline constexpr Bits<T> sign_mask = Bits<T>{1} << (Layout<T>::mantissa_bits + Layout<T>::exponent_bits);
+
+    template <IEEE754 T>
+    inline constexpr Bits<T> mantissa_mask = (Bits<T>{1} << Layout<T>::mantissa_bits) - 1;
+
+    template <IEEE754 T>
+    inline constexpr int exponent_bias = (1 << (Layout<T>::exponent_bits - 1)) - 1;
+
+    template <IEEE754 T>
+    constexpr Bits<T> to_bits(T value) noexcept
+    {
+        return std::bit_cast<Bits<T>>(value);
+    }
+
+    template <IEEE754 T>
+    constexpr T from_bits(Bits<T> bits) noexcept
+    {
+        return std::bit_cast<T>(bits);
+    }
+
+    // true also for -0.0 & NaNs with the sign bit set
+    template <IEEE754 T>
+    constexpr bool sign_bit(T value) noexcept
+    {
+        return (to_bits(value) & sign_mask<T>) != 0;
+    }
+
+    // exponent field as stored - 0 for zeros & subnormals, all ones for infinities & NaNs
+    template <IEEE754 T>
+    constexpr int biased_exponent(T value) noexcept
+    {
+        return static_cast<int>((to_bits(value) & ~sign_mask<T>) >> Layout<T>::mantissa_bits);
+    }
+
+    // power of two of a normal number: 1.5 -> 0, 0.25 -> -2
+    template <IEEE754 T>
+    constexpr int exponent(T value) noexcept
+    {
+        return biased_exponent(value) - exponent_bias<T>;
+    }
+
+    // fraction field without the implicit leading one
+    template <IEEE754 T>
+    constexpr Bits<T> mantissa(T value) noexcept
+    {
+        return to_bits(value) & mantissa_mask<T>;
+    }
+
+    template <IEEE754 T>
+    constexpr T compose(bool sign, int biased_exponent, Bits<T> mantissa)
+    {
+        if (biased_exponent < 0 || biased_exponent >= (1 << Layout<T>::exponent_bits) || mantissa > mantissa_mask<T>)
+            throw std::out_of_range("FloatBits::compose - field out of range");
+
+        return from_bits<T>((sign ? sign_mask<T> : 0) | (static_cast<Bits<T>>(biased_exponent) << Layout<T>::mantissa_bits) | mantissa);
+    }
+
+    // sign operations touch only the sign bit - NaN payloads are preserved, no branches
+    template <IEEE754 T>
+    constexpr T abs(T value) noexcept
+    {
+        return from_bits<T>(to_bits(value) & ~sign_mask<T>);
+    }
+
+    template <IEEE754 T>
+    constexpr T neg(T value) noexcept
+    {
+        return from_bits<T>(to_bits(value) ^ sign_mask<T>);
+    }
+
+    template <IEEE754 T>
+    constexpr T copysign(T magnitude, T sign) noexcept
+    {
+        return from_bits<T>((to_bits(magnitude) & ~sign_mask<T>) | (to_bits(sign) & sign_mask<T>));
+    }
+
+    // unsigned key with the order of values: -NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN
+    //  - negative: all bits flipped, positive: sign bit set - keys can be sorted as integers (radix sort)
+    template <IEEE754 T>
+    constexpr Bits<T> to_ordered(T value) noexcept
+    {
+        constexpr int sign_shift = Layout<T>::mantissa_bits + Layout<T>::exponent_bits;
+
+        const Bits<T> bits = to_bits(value);
+        const Bits<T> flip = static_cast<Bits<T>>(Bits<T>{0} - (bits >> sign_shift)) | sign_mask<T>;
+        return bits ^ flip;
+    }
+
+    template <IEEE754 T>
+    constexpr T from_ordered(Bits<T> key) noexcept
+    {
+        constexpr int sign_shift = Layout<T>::mantissa_bits + Layout<T>::exponent_bits;
+
+        const Bits<T> flip = static_cast<Bits<T>>(((key >> sign_shift) - 1)) | sign_mask<T>;
+        return from_bits<T>(key ^ flip);
+    }
+
+    // next representable values - like std::nextafter (but constexpr): neighbours in the order of to_ordered
+    template <IEEE754 T>
+    constexpr T next_up(T value) noexcept
+    {
+        if (value != value || value == std::numeric_limits<T>::infinity())
+            return value;
+
+        return from_ordered<T>(to_ordered(value + T{0}) + 1); // -0.0 + 0.0 == +0.0
+    }
+
+    template <IEEE754 T>
+    constexpr T next_down(T value) noexcept
+    {
+        return neg(next_up(neg(value)));
+    }
+
+    template <IEEE754 T>
+    constexpr T next_after(T from, T to) noexcept
+    {
+        if (from != from || to != to)
+            return from + to;
+        if (from == to)
+            return to;
+        return from < to ? next_up(from) : next_down(from);
+    }
+
+    namespace Details
+    {
+        // bits = (bits & and_mask) ^ xor_mask - abs, neg & copysign of a whole array
+        template <IEEE754 T>
+        void apply_sign_masks_scalar(T* data, size_t size, Bits<T> and_mask, Bits<T> xor_mask) noexcept
+        {
+            for (size_t i = 0; i < size; ++i)
+                data[i] = from_bits<T>((to_bits(data[i]) & and_mask) ^ xor_mask);
+        }
+
+#ifdef SIMD_HAS_AVX2_PATH
+        SIMD_TARGET_AVX2 inline __m256i broadcast_avx2(uint32_t mask)
+        {
+            return _mm256_set1_epi32(static_cast<int>(mask));
+        }
+
+        SIMD_TARGET_AVX2 inline __m256i broadcast_avx2(uint64_t mask)
+        {
+            return _mm256_set1_epi64x(static_cast<long long>(mask));
+        }
+
+        // returns number of processed items
+        template <IEEE754 T>
+        SIMD_TARGET_AVX2 size_t apply_sign_masks_avx2(T* data, size_t size, Bits<T> and_mask, Bits<T> xor_mask) noexcept
+        {
+            constexpr size_t lanes = 32 / sizeof(T);
+
+            const __m256i and_lanes = broadcast_avx2(and_mask);
+            const __m256i xor_lanes = broadcast_avx2(xor_mask);
+
+            size_t i = 0;
+            for (; i + 2 * lanes <= size; i += 2 * lanes)
+            {
+                auto* block = reinterpret_cast<__m256i*>(data + i);
+                const __m256i first = _mm256_loadu_si256(block);
+                const __m256i second = _mm256_loadu_si256(block + 1);
+                _mm256_storeu_si256(block, _mm256_xor_si256(_mm256_and_si256(first, and_lanes), xor_lanes));
+                _mm256_storeu_si256(block + 1, _mm256_xor_si256(_mm256_and_si256(second, and_lanes), xor_lanes));
+            }
+
+            return i;
+        }
+#endif
+
+        template <IEEE754 T>
+        void apply_sign_masks(std::span<T> values, Bits<T> and_mask, Bits<T> xor_mask) noexcept
+        {
+            size_t done = 0;
+#ifdef SIMD_HAS_AVX2_PATH
+            if (Simd::cpu_has_avx2())
+                done = apply_sign_masks_avx2(values.data(), values.size(), and_mask, xor_mask);
+#endif
+            apply_sign_masks_scalar(values.data() + done, values.size() - done, and_mask, xor_mask);
+        }
+    }
+
+    // in-place versions for arrays
+    template <IEEE754 T>
+    void abs(std::span<T> values) noexcept
+    {
+        Details::apply_sign_masks<T>(values, ~sign_mask<T>, 0);
+    }
+
+    template <IEEE754 T>
+    void neg(std::span<T> values) noexcept
+    {
+        Details::apply_sign_masks<T>(values, ~Bits<T>{0}, sign_mask<T>);
+    }
+
+    template <IEEE754 T>
+    void copysign(std::span<T> magnitudes, T sign) noexcept
+    {
+        Details::apply_sign_masks<T>(magnitudes, ~sign_mask<T>, to_bits(sign) & sign_mask<T>);
+    }
+
+    template <IEEE754 T>
+    void to_ordered(std::span<const T> values, std::span<Bits<T>> keys)
+    {
+        if (keys.size() < values.size())
+            throw std::out_of_range("FloatBits::to_ordered - too few keys");
+
+        for (size_t i = 0; i < values.size(); ++i)
+            keys[i] = to_ordered(values[i]);
+    }
+}
+
+#endif
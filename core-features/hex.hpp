@@ -0,0 +1,243 @@
+#ifndef HEX_HPP
+#define HEX_HPP
+
+#include "simd_dispatch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+namespace Hex
+{
+    enum class LetterCase
+    {
+        upper,
+        lower
+    };
+
+    constexpr size_t encoded_size(size_t no_of_bytes)
+    {
+        return 2 * no_of_bytes;
+    }
+
+    namespace Details
+    {
+        constexpr const char* digits(LetterCase letter_case)
+        {
+            return letter_case == LetterCase::upper ? "0123456789ABCDEF" : "0123456789abcdef";
+        }
+
+        // two digits for every byte - one load per byte in the scalar path
+        template <LetterCase Case>
+        constexpr auto byte_digits = [] {
+            std::array<std::array<char, 2>, 256> table{};
+            for (size_t i = 0; i < table.size(); ++i)
+                table[i] = {digits(Case)[i >> 4], digits(Case)[i & 0xF]};
+            return table;
+        }();
+
+        inline void encode_scalar(const std::byte* src, size_t size, char* dest, LetterCase letter_case)
+        {
+            const auto& table = letter_case == LetterCase::upper ? byte_digits<LetterCase::upper> : byte_digits<LetterCase::lower>;
+            for (size_t i = 0; i < size; ++i)
+                std::memcpy(dest + 2 * i, table[std::to_integer<uint8_t>(src[i])].data(), 2);
+        }
+
+#ifdef SIMD_HAS_AVX2_PATH
+        // nibbles are indexes into a 16-byte table of digits - pshufb translates 32 nibbles at once
+        // returns number of encoded bytes (multiple of 32)
+        SIMD_TARGET_AVX2 inline size_t encode_avx2(const std::byte* src, size_t size, char* dest, LetterCase letter_case)
+        {
+            const __m256i digits_lut = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits(letter_case))));
+            const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+
+            size_t i = 0;
+            for (; i + 32 <= size; i += 32)
+            {
+                const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                const __m256i high = _mm256_shuffle_epi8(digits_lut, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble_mask));
+                const __m256i low = _mm256_shuffle_epi8(digits_lut, _mm256_and_si256(bytes, nibble_mask));
+
+                // unpack interleaves within 128-bit lanes: first = bytes 0-7 | 16-23, second = bytes 8-15 | 24-31
+                const __m256i first = _mm256_unpacklo_epi8(high, low);
+                const __m256i second = _mm256_unpackhi_epi8(high, low);
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 2 * i), _mm256_permute2x128_si256(first, second, 0x20));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 2 * i + 32), _mm256_permute2x128_si256(first, second, 0x31));
+            }
+
+            return i;
+        }
+#endif
+    }
+
+    // writes encoded_size(bytes.size()) chars to dest (no terminating zero) - returns number of written chars
+    inline size_t encode(std::span<const std::byte> bytes, std::span<char> dest, LetterCase letter_case = LetterCase::upper)
+    {
+        if (dest.size() < encoded_size(bytes.size()))
+            throw std::out_of_range("Hex::encode - destination too small");
+
+        size_t done = 0;
+#ifdef SIMD_HAS_AVX2_PATH
+        if (Simd::cpu_has_avx2())
+            done = Details::encode_avx2(bytes.data(), bytes.size(), dest.data(), letter_case);
+#endif
+        Details::encode_scalar(bytes.data() + done, bytes.size() - done, dest.data() + encoded_size(done), letter_case);
+
+        return encoded_size(bytes.size());
+    }
+
+    inline std::string to_hex(std::span<const std::byte> bytes, LetterCase letter_case = LetterCase::upper)
+    {
+        std::string text(encoded_size(bytes.size()), '\0');
+        encode(bytes, text, letter_case);
+        return text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // HexDumper - hexdump -C like listing written to a stream in chunks
+    //   00000010  48 65 6C 6C 6F 2C 20 77  6F 72 6C 64 21 0A 00 01  |Hello, world!...|
+    //  - offsets continue between calls of write() - incomplete line waits for more data or flush()
+    //  - lines are formatted into an internal buffer & written with one ostream::write per block
+    class HexDumper
+    {
+    public:
+        static constexpr size_t bytes_per_line = 16;
+        // offset, " xx" for every byte, extra space in the middle, "  |", chars, "|\n"
+        static constexpr size_t line_length = 8 + 1 + 3 * bytes_per_line + 1 + 3 + bytes_per_line + 2;
+
+    private:
+        static constexpr size_t lines_per_block = 64;
+
+        std::ostream& out_;
+        LetterCase letter_case_;
+        size_t offset_;
+        std::array<std::byte, bytes_per_line> pending_{};
+        size_t no_of_pending_ = 0;
+        std::array<char, encoded_size(bytes_per_line * lines_per_block)> digits_{};
+        std::array<char, line_length * lines_per_block> text_{};
+
+        // digits of the line are already in digits_ (2 chars per byte); offset column shows 32 low bits
+        char* format_line(char* line, const std::byte* bytes, const char* digits, size_t size)
+        {
+            for (int shift = 28, i = 0; shift >= 0; shift -= 4, ++i)
+                line[i] = Details::digits(letter_case_)[(offset_ >> shift) & 0xF];
+            offset_ += size;
+
+            char* pos = line + 8;
+            *pos++ = ' ';
+            for (size_t i = 0; i < bytes_per_line; ++i)
+            {
+                *pos++ = ' ';
+                if (i == bytes_per_line / 2)
+                    *pos++ = ' ';
+
+                if (i < size)
+                    std::memcpy(pos, digits + 2 * i, 2);
+                else
+                    std::memset(pos, ' ', 2);
+                pos += 2;
+            }
+
+            *pos++ = ' ';
+            *pos++ = ' ';
+            *pos++ = '|';
+            for (size_t i = 0; i < size; ++i)
+            {
+                const auto c = std::to_integer<unsigned char>(bytes[i]);
+                *pos++ = c >= 0x20 && c < 0x7F ? static_cast<char>(c) : '.';
+            }
+            *pos++ = '|';
+            *pos++ = '\n';
+
+            return pos;
+        }
+
+        // complete lines only (except for the last line written by flush)
+        void write_lines(const std::byte* bytes, size_t size)
+        {
+            while (size > 0)
+            {
+                const size_t block_size = std::min(size, bytes_per_line * lines_per_block);
+                encode({bytes, block_size}, digits_, letter_case_);
+
+                char* pos = text_.data();
+                for (size_t i = 0; i < block_size; i += bytes_per_line)
+                    pos = format_line(pos, bytes + i, digits_.data() + encoded_size(i), std::min(bytes_per_line, block_size - i));
+
+                out_.write(text_.data(), pos - text_.data());
+
+                bytes += block_size;
+                size -= block_size;
+            }
+        }
+
+    public:
+        explicit HexDumper(std::ostream& out, size_t start_offset = 0, LetterCase letter_case = LetterCase::upper)
+            : out_{out}
+            , letter_case_{letter_case}
+            , offset_{start_offset}
+        {
+        }
+
+        HexDumper(const HexDumper&) = delete;
+        HexDumper& operator=(const HexDumper&) = delete;
+
+        ~HexDumper()
+        {
+            flush();
+        }
+
+        size_t offset() const
+        {
+            return offset_ + no_of_pending_;
+        }
+
+        void write(std::span<const std::byte> bytes)
+        {
+            if (no_of_pending_ > 0)
+            {
+                const size_t count = std::min(bytes_per_line - no_of_pending_, bytes.size());
+                std::copy_n(bytes.begin(), count, pending_.begin() + no_of_pending_);
+                no_of_pending_ += count;
+                bytes = bytes.subspan(count);
+
+                if (no_of_pending_ < bytes_per_line)
+                    return;
+
+                write_lines(pending_.data(), bytes_per_line);
+                no_of_pending_ = 0;
+            }
+
+            const size_t complete = bytes.size() - bytes.size() % bytes_per_line;
+            write_lines(bytes.data(), complete);
+
+            no_of_pending_ = bytes.size() - complete;
+            std::copy_n(bytes.begin() + complete, no_of_pending_, pending_.begin());
+        }
+
+        // writes an incomplete line
+        void flush()
+        {
+            if (no_of_pending_ > 0)
+            {
+                write_lines(pending_.data(), no_of_pending_);
+                no_of_pending_ = 0;
+            }
+        }
+    };
+
+    inline void hexdump(std::ostream& out, std::span<const std::byte> bytes, size_t start_offset = 0, LetterCase letter_case = LetterCase::upper)
+    {
+        HexDumper dumper{out, start_offset, letter_case};
+        dumper.write(bytes);
+    }
+}
+
+#endif
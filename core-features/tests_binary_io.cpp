@@ -0,0 +1,294 @@
+#include "binary_io.hpp"
+
+#include <algorithm>
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Serialization;
+
+namespace
+{
+    enum class Color : uint8_t
+    {
+        red,
+        green,
+        blue
+    };
+
+    std::vector<std::byte> bytes(std::initializer_list<int> values)
+    {
+        std::vector<std::byte> result;
+        for (int value : values)
+            result.push_back(static_cast<std::byte>(value));
+        return result;
+    }
+}
+
+TEST_CASE("zigzag & varint sizes")
+{
+    static_assert(zigzag_encode(0) == 0u);
+    static_assert(zigzag_encode(-1) == 1u);
+    static_assert(zigzag_encode(1) == 2u);
+    static_assert(zigzag_encode(std::numeric_limits<int64_t>::min()) == std::numeric_limits<uint64_t>::max());
+    static_assert(zigzag_decode(zigzag_encode(-665)) == -665);
+
+    static_assert(varint_size(0u) == 1);
+    static_assert(varint_size(127u) == 1);
+    static_assert(varint_size(128u) == 2);
+    static_assert(varint_size(std::numeric_limits<uint64_t>::max()) == max_varint_size);
+
+    static_assert(byteswap(uint32_t{0x12345678}) == 0x78563412);
+}
+
+TEST_CASE("BinaryWriter & BinaryReader")
+{
+    std::array<std::byte, 256> buffer{};
+    BinaryWriter writer{buffer};
+
+    SECTION("scalars are stored in little-endian order")
+    {
+        writer.write(uint32_t{0x12345678});
+        writer.write(Color::blue);
+
+        REQUIRE(std::ranges::equal(writer.written(), bytes({0x78, 0x56, 0x34, 0x12, 0x02})));
+    }
+
+    SECTION("varints")
+    {
+        writer.write_varint(300u);
+        writer.write_varint(-2);
+
+        REQUIRE(std::ranges::equal(writer.written(), bytes({0xAC, 0x02, 0x03})));
+    }
+
+    SECTION("round trip")
+    {
+        const std::vector<double> samples = {3.14, -0.0, 1e300};
+
+        writer.write(3.141592f);
+        writer.write(true);
+        writer.write_varint(std::numeric_limits<uint64_t>::max());
+        writer.write_varint(std::numeric_limits<int64_t>::min());
+        writer.write_string("espresso");
+        writer.write_array(std::span<const double>{samples});
+
+        BinaryReader reader{writer.written()};
+
+        REQUIRE(reader.read<float>() == 3.141592f);
+        REQUIRE(reader.read<bool>() == true);
+        REQUIRE(reader.read_varint<uint64_t>() == std::numeric_limits<uint64_t>::max());
+        REQUIRE(reader.read_varint<int64_t>() == std::numeric_limits<int64_t>::min());
+
+        std::string_view name = reader.read_string();
+        REQUIRE(name == "espresso");
+        REQUIRE(reinterpret_cast<const std::byte*>(name.data()) >= buffer.data()); // view of the buffer - no copy
+        REQUIRE(reinterpret_cast<const std::byte*>(name.data()) < buffer.data() + buffer.size());
+
+        std::vector<double> loaded(samples.size());
+        reader.read_array(std::span{loaded});
+        REQUIRE(loaded == samples);
+
+        REQUIRE(reader.remaining() == 0);
+    }
+
+    SECTION("writes past the end of buffer throw")
+    {
+        std::array<std::byte, 3> small{};
+        BinaryWriter small_writer{small};
+
+        REQUIRE_THROWS_AS(small_writer.write(uint32_t{1}), std::out_of_range);
+        REQUIRE_THROWS_AS(small_writer.write_varint(uint64_t{1} << 21), std::out_of_range); // 4 bytes
+        REQUIRE(small_writer.position() == 0);
+    }
+}
+
+TEST_CASE("BinaryReader - reads are bounds-checked")
+{
+    SECTION("truncated scalar")
+    {
+        const auto data = bytes({0x01, 0x02});
+        BinaryReader reader{data};
+
+        REQUIRE_THROWS_AS(reader.read<uint32_t>(), std::out_of_range);
+        REQUIRE(reader.read<uint16_t>() == 0x0201);
+    }
+
+    SECTION("truncated varint")
+    {
+        const auto data = bytes({0x80, 0x80});
+        BinaryReader reader{data};
+
+        REQUIRE_THROWS_AS(reader.read_varint<uint32_t>(), std::out_of_range);
+    }
+
+    SECTION("string longer than data")
+    {
+        const auto data = bytes({0x05, 'a', 'b'});
+        BinaryReader reader{data};
+
+        REQUIRE_THROWS_AS(reader.read_string(), std::out_of_range);
+    }
+
+    SECTION("varint too big for the type")
+    {
+        const auto data = bytes({0x80, 0x02});
+        BinaryReader reader{data};
+
+        REQUIRE_THROWS_AS(reader.read_varint<uint8_t>(), std::out_of_range);
+        REQUIRE(reader.read_varint<uint16_t>() == 256);
+    }
+
+    SECTION("varint longer than 10 bytes")
+    {
+        const auto data = bytes({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01});
+        BinaryReader reader{data};
+
+        REQUIRE_THROWS_AS(reader.read_varint<uint64_t>(), std::out_of_range);
+    }
+}
+
+namespace
+{
+    struct Record
+    {
+        uint32_t id;
+        int64_t delta;
+        double price;
+        Color color;
+        std::string name;
+
+        bool operator==(const Record&) const = default;
+    };
+
+    std::vector<Record> make_records(size_t count)
+    {
+        const std::array<std::string, 4> names = {"espresso", "cappuccino", "flat white", "v60"};
+
+        std::mt19937_64 rnd{665};
+        std::uniform_int_distribution<int64_t> delta_distr{-1000, 1000};
+        std::uniform_real_distribution<double> price_distr{1.0, 20.0};
+
+        std::vector<Record> records(count);
+        for (size_t i = 0; i < count; ++i)
+            records[i] = Record{static_cast<uint32_t>(i), delta_distr(rnd), price_distr(rnd), static_cast<Color>(i % 3), names[i % names.size()]};
+        return records;
+    }
+
+    template <typename T>
+    void write_raw(std::ostream& out, const T& value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    void read_raw(std::istream& in, T& value)
+    {
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+}
+
+TEST_CASE("binary serialization vs std::ostringstream - 10^7 records", "[.][benchmark]")
+{
+    constexpr size_t size = 10'000'000;
+
+    const auto records = make_records(size);
+
+    auto encode_stream = [&records] {
+        std::ostringstream out;
+        for (const auto& r : records)
+        {
+            write_raw(out, r.id);
+            write_raw(out, r.delta);
+            write_raw(out, r.price);
+            write_raw(out, r.color);
+            write_raw(out, r.name.size());
+            out.write(r.name.data(), static_cast<std::streamsize>(r.name.size()));
+        }
+        return std::move(out).str();
+    };
+
+    std::vector<std::byte> buffer(size * 32);
+    auto encode_binary = [&records, &buffer] {
+        BinaryWriter writer{buffer};
+        for (const auto& r : records)
+        {
+            writer.write_varint(r.id);
+            writer.write_varint(r.delta);
+            writer.write(r.price);
+            writer.write(r.color);
+            writer.write_string(r.name);
+        }
+        return writer.position();
+    };
+
+    std::vector<Record> loaded(size);
+
+    auto decode_stream = [&loaded](const std::string& stream_data) {
+        std::istringstream in{stream_data};
+        for (auto& r : loaded)
+        {
+            size_t name_size;
+            read_raw(in, r.id);
+            read_raw(in, r.delta);
+            read_raw(in, r.price);
+            read_raw(in, r.color);
+            read_raw(in, name_size);
+            r.name.resize(name_size);
+            in.read(r.name.data(), static_cast<std::streamsize>(name_size));
+        }
+        return loaded.size();
+    };
+
+    auto decode_binary = [&loaded, &buffer](size_t binary_size) {
+        BinaryReader reader{std::span{buffer}.first(binary_size)};
+        for (auto& r : loaded)
+        {
+            r.id = reader.read_varint<uint32_t>();
+            r.delta = reader.read_varint<int64_t>();
+            r.price = reader.read<double>();
+            r.color = reader.read<Color>();
+            r.name = reader.read_string();
+        }
+        return reader.remaining();
+    };
+
+    const std::string stream_data = encode_stream();
+    const size_t binary_size = encode_binary();
+    REQUIRE(binary_size < stream_data.size()); // varints - 8 bytes of size_t for every name in the stream
+
+    decode_stream(stream_data);
+    REQUIRE(loaded == records);
+
+    std::ranges::fill(loaded, Record{});
+    decode_binary(binary_size);
+    REQUIRE(loaded == records);
+
+    BENCHMARK("encode - std::ostringstream")
+    {
+        return encode_stream();
+    };
+
+    BENCHMARK("encode - BinaryWriter")
+    {
+        return encode_binary();
+    };
+
+    BENCHMARK("decode - std::istringstream")
+    {
+        return decode_stream(stream_data);
+    };
+
+    BENCHMARK("decode - BinaryReader")
+    {
+        return decode_binary(binary_size);
+    };
+}
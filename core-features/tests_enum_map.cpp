@@ -0,0 +1,139 @@
+#include "enum_map.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using Enums::enum_map;
+
+namespace
+{
+    enum class Weekday
+    {
+        mon,
+        tue,
+        wed,
+        thu,
+        fri,
+        sat,
+        sun
+    };
+
+    enum class Signal : int8_t
+    {
+        error = -1,
+        idle = 0,
+        busy = 5,
+        done = 100
+    };
+}
+
+TEST_CASE("enum reflection - values & names found at compile time")
+{
+    static_assert(Enums::enum_count<Weekday> == 7);
+    static_assert(Enums::enum_names<Weekday>.front() == "mon");
+    static_assert(Enums::enum_name(Weekday::sun) == "sun");
+
+    static_assert(Enums::enum_count<Signal> == 4);
+    static_assert(Enums::enum_values<Signal>[0] == Signal::error);
+    static_assert(Enums::enum_names<Signal>[3] == "done");
+
+    REQUIRE(Enums::enum_name(static_cast<Signal>(4)) == "");
+    REQUIRE(Enums::enum_index(static_cast<Signal>(99)) == std::nullopt);
+    REQUIRE(Enums::enum_index(Signal::done) == 3);
+}
+
+TEST_CASE("enum_map")
+{
+    enum_map<Signal, std::string> descriptions = {{Signal::idle, "waiting"}, {Signal::done, "finished"}};
+
+    static_assert(enum_map<Signal, std::string>::size() == 4);
+
+    SECTION("missing enumerators are value-initialized")
+    {
+        REQUIRE(descriptions[Signal::busy] == "");
+        REQUIRE(descriptions[Signal::done] == "finished");
+    }
+
+    SECTION("at() throws for values that are not enumerators")
+    {
+        REQUIRE_THROWS_AS(descriptions.at(static_cast<Signal>(42)), std::out_of_range);
+    }
+
+    SECTION("iteration in order of enum values - structured bindings")
+    {
+        for (auto [signal, description] : descriptions)
+            if (description.empty())
+                description = Enums::enum_name(signal);
+
+        std::vector<std::pair<Signal, std::string>> items;
+        for (const auto& [signal, description] : descriptions)
+            items.emplace_back(signal, description);
+
+        REQUIRE(items
+            == std::vector<std::pair<Signal, std::string>>{
+                {Signal::error, "error"}, {Signal::idle, "waiting"}, {Signal::busy, "busy"}, {Signal::done, "finished"}});
+    }
+
+    SECTION("values are contiguous")
+    {
+        REQUIRE(descriptions.values().size() == 4);
+        REQUIRE(descriptions.values()[1] == "waiting");
+    }
+}
+
+TEST_CASE("enum_map - constexpr enum-to-string table")
+{
+    constexpr enum_map<Weekday, std::string_view> short_names = {{Weekday::mon, "Mo"}, {Weekday::sat, "Sa"}, {Weekday::sun, "Su"}};
+
+    static_assert(short_names[Weekday::sat] == "Sa");
+    static_assert(short_names.at(Weekday::tue).empty());
+}
+
+TEST_CASE("enum_map vs std::map", "[.][benchmark]")
+{
+    constexpr size_t no_of_lookups = 10'000;
+
+    std::map<Weekday, std::string> tree;
+    enum_map<Weekday, std::string> dense;
+    std::vector<std::string> vec(Enums::enum_count<Weekday>);
+    for (Weekday day : Enums::enum_values<Weekday>)
+        tree[day] = dense[day] = vec[static_cast<size_t>(day)] = std::string{Enums::enum_name(day)};
+
+    std::mt19937 rnd{665};
+    std::uniform_int_distribution<int> distr{0, 6};
+    std::vector<Weekday> keys(no_of_lookups);
+    std::ranges::generate(keys, [&] { return static_cast<Weekday>(distr(rnd)); });
+
+    BENCHMARK("lookup - std::map")
+    {
+        size_t total = 0;
+        for (Weekday day : keys)
+            total += tree.find(day)->second.size();
+        return total;
+    };
+
+    BENCHMARK("lookup - vector[static_cast<size_t>]")
+    {
+        size_t total = 0;
+        for (Weekday day : keys)
+            total += vec[static_cast<size_t>(day)].size();
+        return total;
+    };
+
+    BENCHMARK("lookup - enum_map")
+    {
+        size_t total = 0;
+        for (Weekday day : keys)
+            total += dense[day].size();
+        return total;
+    };
+}
@@ -0,0 +1,169 @@
+#include "enum_set.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using Enums::enum_set;
+
+namespace
+{
+    enum class Coffee : uint8_t
+    {
+        espresso,
+        cappuccino,
+        flat_white,
+        americano = 10,
+        v60,
+        chemex
+    };
+
+    // more enumerators than bits in a word
+    enum class Flag : uint8_t
+    {
+        f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19,
+        f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39,
+        f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59,
+        f60, f61, f62, f63, f64, f65, f66, f67, f68, f69
+    };
+}
+
+TEST_CASE("enum_set")
+{
+    constexpr enum_set<Coffee> with_milk = {Coffee::cappuccino, Coffee::flat_white};
+    constexpr enum_set<Coffee> filtered = {Coffee::americano, Coffee::v60, Coffee::chemex};
+
+    static_assert(sizeof(enum_set<Coffee>) == sizeof(uint64_t));
+    static_assert(with_milk.contains(Coffee::flat_white));
+    static_assert(!with_milk.contains(Coffee::espresso));
+    static_assert((with_milk | filtered).size() == 5);
+    static_assert((with_milk & filtered).empty());
+    static_assert(enum_set<Coffee>::all().size() == 6);
+    static_assert(~(with_milk | filtered) == enum_set<Coffee>{Coffee::espresso});
+
+    SECTION("iteration in order of enum values")
+    {
+        enum_set<Coffee> selection = {Coffee::chemex, Coffee::espresso, Coffee::americano};
+
+        std::vector<Coffee> coffees(selection.begin(), selection.end());
+
+        REQUIRE(coffees == std::vector{Coffee::espresso, Coffee::americano, Coffee::chemex});
+    }
+
+    SECTION("insert & erase")
+    {
+        enum_set<Coffee> selection;
+        selection.insert(Coffee::v60);
+        selection.insert(Coffee::v60);
+        REQUIRE(selection.size() == 1);
+
+        selection.erase(Coffee::v60);
+        REQUIRE(selection.empty());
+
+        REQUIRE_THROWS_AS(selection.insert(static_cast<Coffee>(4)), std::out_of_range);
+        REQUIRE_FALSE(selection.contains(static_cast<Coffee>(4)));
+    }
+
+    SECTION("subset & difference")
+    {
+        REQUIRE(with_milk.is_subset_of(~filtered));
+        REQUIRE_FALSE(with_milk.intersects(filtered));
+        REQUIRE((enum_set<Coffee>::all() - filtered - with_milk) == enum_set<Coffee>{Coffee::espresso});
+    }
+}
+
+TEST_CASE("enum_set - many words")
+{
+    static_assert(sizeof(enum_set<Flag>) == 2 * sizeof(uint64_t));
+
+    enum_set<Flag> flags = {Flag::f0, Flag::f63, Flag::f64, Flag::f69};
+
+    REQUIRE(flags.size() == 4);
+    REQUIRE(std::vector<Flag>(flags.begin(), flags.end()) == std::vector{Flag::f0, Flag::f63, Flag::f64, Flag::f69});
+    REQUIRE((~flags).size() == 66);
+    REQUIRE(enum_set<Flag>::all().size() == 70);
+    REQUIRE(std::ranges::distance(enum_set<Flag>{}.begin(), enum_set<Flag>{}.end()) == 0);
+}
+
+TEST_CASE("enum_set vs std::set", "[.][benchmark]")
+{
+    constexpr size_t no_of_sets = 10'000;
+
+    std::mt19937 rnd{665};
+    std::bernoulli_distribution coin;
+
+    std::vector<std::set<Coffee>> trees(no_of_sets);
+    std::vector<enum_set<Coffee>> bitsets(no_of_sets);
+    for (size_t i = 0; i < no_of_sets; ++i)
+        for (Coffee coffee : Enums::enum_values<Coffee>)
+            if (coin(rnd))
+            {
+                trees[i].insert(coffee);
+                bitsets[i].insert(coffee);
+            }
+
+    const std::set<Coffee> filter_tree = {Coffee::espresso, Coffee::v60, Coffee::chemex};
+    const enum_set<Coffee> filter_bits = {Coffee::espresso, Coffee::v60, Coffee::chemex};
+
+    BENCHMARK("union - std::set")
+    {
+        size_t total = 0;
+        for (const auto& tree : trees)
+        {
+            std::set<Coffee> result;
+            std::ranges::set_union(tree, filter_tree, std::inserter(result, result.end()));
+            total += result.size();
+        }
+        return total;
+    };
+
+    BENCHMARK("union - enum_set")
+    {
+        size_t total = 0;
+        for (const auto& bits : bitsets)
+            total += (bits | filter_bits).size();
+        return total;
+    };
+
+    BENCHMARK("intersection - std::set")
+    {
+        size_t total = 0;
+        for (const auto& tree : trees)
+        {
+            std::set<Coffee> result;
+            std::ranges::set_intersection(tree, filter_tree, std::inserter(result, result.end()));
+            total += result.size();
+        }
+        return total;
+    };
+
+    BENCHMARK("intersection - enum_set")
+    {
+        size_t total = 0;
+        for (const auto& bits : bitsets)
+            total += (bits & filter_bits).size();
+        return total;
+    };
+
+    BENCHMARK("contains - std::set")
+    {
+        size_t total = 0;
+        for (const auto& tree : trees)
+            total += tree.contains(Coffee::americano);
+        return total;
+    };
+
+    BENCHMARK("contains - enum_set")
+    {
+        size_t total = 0;
+        for (const auto& bits : bitsets)
+            total += bits.contains(Coffee::americano);
+        return total;
+    };
+}
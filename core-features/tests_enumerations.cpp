@@ -1,3 +1,6 @@
+#include "enum_map.hpp"
+#include "float_bits.hpp"
+
 #include <algorithm>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -18,6 +21,17 @@ enum State : uint16_t
 
 static_assert(sizeof(State) == 2);
 
+// faulty = 665 is out of the default range scanned for enumerators
+template <>
+struct Enums::enum_range<State>
+{
+    static constexpr int min = 0;
+    static constexpr int max = 665;
+};
+
+static_assert(Enums::enum_count<State> == 3);
+static_assert(Enums::enum_name(faulty) == "faulty");
+
 TEST_CASE("classic enums")
 {
     State s = open;
@@ -39,6 +53,12 @@ enum class Coffee : uint8_t
     chemex
 };
 
+// enum_map stores only declared enumerators - a gap after flat_white takes no space
+static_assert(Enums::enum_count<Coffee> == 6);
+static_assert(sizeof(Enums::enum_map<Coffee, int>) == 6 * sizeof(int));
+static_assert(Enums::enum_index(Coffee::americano) == 3);
+static_assert(!Enums::enum_index(static_cast<Coffee>(4)));
+
 namespace Cpp23
 {
     template <typename TEnum>
@@ -103,6 +123,21 @@ TEST_CASE("enums & containers")
         {DaysOfWeek::Sunday, "Niedziela"}};
 
     std::cout << days[DaysOfWeek::Monday] << "\n";
+
+    // dense array indexed by enum - no search at all
+    Enums::enum_map<DaysOfWeek, std::string> dense_days = {
+        {DaysOfWeek::Monday, "Poniedziałek"},
+        {DaysOfWeek::Tuesday, "Wtorek"},
+        {DaysOfWeek::Wednesday, "Środa"},
+        {DaysOfWeek::Thursday, "Czwartek"},
+        {DaysOfWeek::Friday, "Piątek"},
+        {DaysOfWeek::Saturday, "Sobota"},
+        {DaysOfWeek::Sunday, "Niedziela"}};
+
+    for (const auto& [day, name] : dense_days)
+        std::cout << Enums::enum_name(day) << " - " << name << "\n";
+
+    REQUIRE(dense_days[DaysOfWeek::Sunday] == days[DaysOfWeek::Sunday]);
 }
 
 namespace Explain
@@ -156,4 +191,7 @@ TEST_CASE("memory as bytes")
     writable_bytes[3] |= std::byte{0B1000'0000};
 
     print(data[0], const_bytes);
+
+    // index of the byte with the sign bit depends on endianness - std::bit_cast works on the value
+    REQUIRE(data[0] == FloatBits::neg(3.141592f));
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include "float_bits.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+using namespace FloatBits;
+
+TEST_CASE("FloatBits - fields of IEEE-754 values")
+{
+    static_assert(!sign_bit(1.5f));
+    static_assert(sign_bit(-0.0));
+    static_assert(exponent(1.5f) == 0);
+    static_assert(exponent(0.25) == -2);
+    static_assert(mantissa(1.5f) == (1u << 22));
+    static_assert(biased_exponent(std::numeric_limits<float>::infinity()) == 255);
+    static_assert(biased_exponent(std::numeric_limits<double>::denorm_min()) == 0);
+    static_assert(compose<float>(true, 127, 1u << 22) == -1.5f);
+
+    REQUIRE_THROWS_AS(compose<float>(false, 256, 0), std::out_of_range);
+    REQUIRE_THROWS_AS(compose<double>(false, 0, uint64_t{1} << 52), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("FloatBits - sign operations", "", float, double)
+{
+    using T = TestType;
+
+    constexpr T pi = static_cast<T>(3.141592);
+    static_assert(abs(-pi) == pi);
+    static_assert(neg(pi) == -pi);
+    static_assert(copysign(pi, T{-0.0}) == -pi);
+
+    SECTION("zeros & NaNs keep all bits except the sign")
+    {
+        REQUIRE_FALSE(sign_bit(abs(T{-0.0})));
+        REQUIRE(sign_bit(neg(T{0.0})));
+
+        const T nan = from_bits<T>(to_bits(std::numeric_limits<T>::quiet_NaN()) | 1);
+        REQUIRE(to_bits(neg(nan)) == (to_bits(nan) ^ sign_mask<T>));
+        REQUIRE(to_bits(abs(neg(nan))) == to_bits(nan));
+    }
+
+    SECTION("arrays - vector path & tail give the same results as std::fabs")
+    {
+        std::vector<T> values(103);
+        for (size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<T>(i % 2 == 0 ? -1.0 : 1.0) * static_cast<T>(i) / 7;
+
+        std::vector<T> expected(values.size());
+        std::ranges::transform(values, expected.begin(), [](T x) { return std::fabs(x); });
+
+        abs(std::span{values});
+        REQUIRE(values == expected);
+
+        neg(std::span{values});
+        REQUIRE(std::ranges::all_of(values, [](T x) { return sign_bit(x); }));
+
+        copysign(std::span{values}, T{1.0});
+        REQUIRE(values == expected);
+    }
+}
+
+TEMPLATE_TEST_CASE("FloatBits - next_up, next_down & next_after", "", float, double)
+{
+    using T = TestType;
+    using limits = std::numeric_limits<T>;
+
+    static_assert(next_up(T{1.0}) == T{1.0} + limits::epsilon());
+    static_assert(next_up(T{-0.0}) == limits::denorm_min());
+
+    const std::vector<T> values = {T{0.0}, T{-0.0}, T{1.0}, T{-1.0}, limits::denorm_min(), -limits::denorm_min(), limits::min(), -limits::min(),
+        limits::max(), -limits::max(), limits::infinity(), -limits::infinity(), static_cast<T>(3.141592), static_cast<T>(-1e-30)};
+
+    for (T from : values)
+        for (T to : {limits::infinity(), -limits::infinity(), T{0.0}, T{-0.0}, T{1.0}})
+        {
+            INFO(from << " -> " << to);
+            REQUIRE(to_bits(next_after(from, to)) == to_bits(std::nextafter(from, to)));
+        }
+
+    REQUIRE(std::isnan(next_up(limits::quiet_NaN())));
+    REQUIRE(std::isnan(next_after(T{1.0}, limits::quiet_NaN())));
+}
+
+TEMPLATE_TEST_CASE("FloatBits - ordered keys sort like values", "", float, double)
+{
+    using T = TestType;
+    using limits = std::numeric_limits<T>;
+
+    std::vector<T> values = {T{2.5}, -limits::infinity(), T{-0.0}, limits::denorm_min(), T{0.0}, -limits::max(), T{-1.0}, limits::infinity(), T{1.0}, -limits::denorm_min()};
+
+    std::vector<Bits<T>> keys(values.size());
+    to_ordered(std::span<const T>{values}, std::span{keys});
+    std::ranges::sort(keys);
+
+    std::vector<T> sorted(values.size());
+    std::ranges::transform(keys, sorted.begin(), [](Bits<T> key) { return from_ordered<T>(key); });
+
+    std::ranges::sort(values, std::less{});
+    REQUIRE(std::ranges::equal(sorted, values));
+    REQUIRE(sign_bit(sorted[4])); // -0.0 before +0.0
+    REQUIRE_FALSE(sign_bit(sorted[5]));
+
+    for (T value : values)
+        REQUIRE(to_bits(from_ordered<T>(to_ordered(value))) == to_bits(value));
+}
+
+TEST_CASE("bulk abs & neg - 10^8 floats", "[.][benchmark]")
+{
+    std::mt19937 rnd{665};
+    std::uniform_real_distribution<float> distr{-1000.0f, 1000.0f};
+    std::vector<float> data(100'000'000);
+    std::ranges::generate(data, [&] { return distr(rnd); });
+
+    // in place - every run of a benchmark works on the result of the previous one
+    BENCHMARK("abs - std::transform(std::fabs)")
+    {
+        std::ranges::transform(data, data.begin(), [](float x) { return std::fabs(x); });
+    };
+
+    BENCHMARK("abs - FloatBits::abs(span)")
+    {
+        FloatBits::abs(std::span{data});
+    };
+
+    BENCHMARK("neg - std::transform(std::negate)")
+    {
+        std::ranges::transform(data, data.begin(), std::negate{});
+    };
+
+    BENCHMARK("neg - FloatBits::neg(span)")
+    {
+        FloatBits::neg(std::span{data});
+    };
+
+    FloatBits::abs(std::span{data});
+    REQUIRE(std::ranges::all_of(data, [](float x) { return x >= 0.0f; }));
+}
@@ -0,0 +1,132 @@
+#include "hex.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <iomanip>
+#include <random>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<std::byte> random_bytes(size_t size)
+    {
+        std::mt19937 rnd{665};
+        std::uniform_int_distribution<int> distr{0, 255};
+
+        std::vector<std::byte> bytes(size);
+        for (auto& b : bytes)
+            b = static_cast<std::byte>(distr(rnd));
+        return bytes;
+    }
+
+    // formatting of print() from tests_enumerations.cpp
+    void print_hex(std::ostream& out, std::span<const std::byte> bytes)
+    {
+        out << std::hex << std::uppercase << std::setfill('0');
+        for (auto const b : bytes)
+            out << std::setw(2) << std::to_integer<int>(b) << ' ';
+        out << std::dec;
+    }
+}
+
+TEST_CASE("Hex::to_hex")
+{
+    const std::vector<std::byte> bytes = {std::byte{0xDB}, std::byte{0x0F}, std::byte{0x49}, std::byte{0x40}};
+
+    REQUIRE(Hex::to_hex(bytes) == "DB0F4940");
+    REQUIRE(Hex::to_hex(bytes, Hex::LetterCase::lower) == "db0f4940");
+    REQUIRE(Hex::to_hex({}) == "");
+
+    SECTION("all lengths - vector & scalar paths give the same digits")
+    {
+        const auto data = random_bytes(200);
+
+        for (size_t size = 0; size <= data.size(); ++size)
+        {
+            std::ostringstream expected;
+            expected << std::hex << std::uppercase << std::setfill('0');
+            for (size_t i = 0; i < size; ++i)
+                expected << std::setw(2) << std::to_integer<int>(data[i]);
+
+            REQUIRE(Hex::to_hex(std::span{data}.first(size)) == expected.str());
+        }
+    }
+
+    SECTION("destination too small")
+    {
+        char buffer[7];
+        REQUIRE_THROWS_AS(Hex::encode(bytes, buffer), std::out_of_range);
+    }
+}
+
+TEST_CASE("Hex::hexdump")
+{
+    const std::string text = "Hello, world!\n";
+    std::vector<std::byte> data(text.size());
+    std::ranges::transform(text, data.begin(), [](char c) { return static_cast<std::byte>(c); });
+    data.push_back(std::byte{0x00});
+    data.push_back(std::byte{0xFF});
+    data.push_back(std::byte{0x41});
+
+    std::ostringstream out;
+    Hex::hexdump(out, data, 0x10, Hex::LetterCase::lower);
+
+    REQUIRE(out.str()
+        == "00000010  48 65 6c 6c 6f 2c 20 77  6f 72 6c 64 21 0a 00 ff  |Hello, world!...|\n"
+           "00000020  41                                                |A|\n");
+
+    SECTION("streaming - chunks of any size give the same listing")
+    {
+        const auto bytes = random_bytes(3000);
+
+        std::ostringstream whole;
+        Hex::hexdump(whole, bytes);
+
+        std::ostringstream chunked;
+        {
+            Hex::HexDumper dumper{chunked};
+            for (size_t i = 0, chunk = 1; i < bytes.size(); i += chunk, chunk = chunk * 3 % 101 + 1)
+                dumper.write(std::span{bytes}.subspan(i, std::min(chunk, bytes.size() - i)));
+
+            REQUIRE(dumper.offset() == bytes.size());
+        }
+
+        REQUIRE(chunked.str() == whole.str());
+        REQUIRE(static_cast<size_t>(std::ranges::count(whole.str(), '\n')) == (bytes.size() + 15) / 16);
+    }
+}
+
+TEST_CASE("hex encoding vs iostream manipulators - 64 MB", "[.][benchmark]")
+{
+    constexpr size_t size = 64 * 1024 * 1024;
+
+    const auto bytes = random_bytes(size);
+    std::string text(Hex::encoded_size(size), '\0');
+
+    BENCHMARK("print() - setw/setfill/hex per byte")
+    {
+        std::ostringstream out;
+        print_hex(out, bytes);
+        return out.str().size();
+    };
+
+    BENCHMARK("Hex::encode - preallocated buffer")
+    {
+        return Hex::encode(bytes, text);
+    };
+
+    BENCHMARK("Hex::hexdump")
+    {
+        std::ostringstream out;
+        Hex::hexdump(out, bytes);
+        return out.str().size();
+    };
+
+    REQUIRE(Hex::encode(bytes, text) == text.size());
+}
@@ -0,0 +1,287 @@
+#ifndef CALLBACK_REGISTRY_HPP
+#define CALLBACK_REGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <typename TSignature, size_t InlineSize = 32>
+class CallbackRegistry;
+
+/////////////////////////////////////////////////////////////////////////////
+// CallbackRegistry - many subscribers invoked with the same arguments
+//  - callbacks are stored in a contiguous array of slots: function pointer + inline state
+//    (callables larger than InlineSize are stored on the heap)
+//  - trivially copyable callables are relocated with memcpy - no per-type move/destroy calls
+//  - subscribe() returns a handle - unsubscribe(handle) is O(1) (the last slot fills the gap),
+//    so the order of invocation is not preserved
+//  - callbacks must not subscribe/unsubscribe while being invoked
+template <typename... TArgs, size_t InlineSize>
+class CallbackRegistry<void(TArgs...), InlineSize>
+{
+public:
+    struct Subscription
+    {
+        uint32_t index;
+        uint32_t generation;
+    };
+
+private:
+    struct Ops
+    {
+        void (*move_to)(void* src, void* dest) noexcept; // move-constructs into dest & destroys src
+        void (*destroy)(void* state) noexcept;
+    };
+
+    template <typename F>
+    static constexpr bool is_stored_inline = sizeof(F) <= InlineSize
+        && alignof(F) <= alignof(std::max_align_t)
+        && std::is_nothrow_move_constructible_v<F>;
+
+    template <typename F>
+    static F* state_of(void* state) noexcept
+    {
+        if constexpr (is_stored_inline<F>)
+            return std::launder(static_cast<F*>(state));
+        else
+            return *std::launder(static_cast<F**>(state));
+    }
+
+    template <typename F>
+    static void invoke_callable(void* state, TArgs... args)
+    {
+        (*state_of<F>(state))(std::forward<TArgs>(args)...);
+    }
+
+    template <typename F>
+    static constexpr Ops ops_for{
+        [](void* src, void* dest) noexcept {
+            F* f = std::launder(static_cast<F*>(src));
+            ::new (dest) F(std::move(*f));
+            f->~F();
+        },
+        [](void* state) noexcept { std::launder(static_cast<F*>(state))->~F(); }};
+
+    template <typename F>
+    static constexpr Ops heap_ops_for{
+        [](void* src, void* dest) noexcept { ::new (dest) F*(*std::launder(static_cast<F**>(src))); },
+        [](void* state) noexcept { delete *std::launder(static_cast<F**>(state)); }};
+
+    struct Slot
+    {
+        void (*invoke)(void* state, TArgs... args);
+        const Ops* ops; // nullptr - trivially copyable & destructible state
+        alignas(std::max_align_t) std::byte state[InlineSize];
+        uint32_t handle_index;
+
+        Slot() = default;
+
+        Slot(Slot&& other) noexcept
+            : invoke{other.invoke}
+            , ops{other.ops}
+            , handle_index{other.handle_index}
+        {
+            if (ops)
+                ops->move_to(other.state, state);
+            else
+                std::memcpy(state, other.state, InlineSize);
+
+            other.ops = nullptr; // nothing left to destroy
+        }
+
+        Slot& operator=(Slot&& other) noexcept
+        {
+            if (this != &other)
+            {
+                this->~Slot();
+                ::new (this) Slot(std::move(other));
+            }
+            return *this;
+        }
+
+        ~Slot()
+        {
+            if (ops)
+                ops->destroy(state);
+        }
+    };
+
+    struct HandleEntry
+    {
+        uint32_t slot_index;
+        uint32_t generation;
+    };
+
+    static constexpr uint32_t no_slot = UINT32_MAX;
+
+    std::vector<Slot> slots_;
+    std::vector<HandleEntry> handles_;
+    std::vector<uint32_t> free_handles_;
+    bool is_invoking_ = false;
+
+public:
+    CallbackRegistry() = default;
+    CallbackRegistry(const CallbackRegistry&) = delete;
+    CallbackRegistry& operator=(const CallbackRegistry&) = delete;
+    CallbackRegistry(CallbackRegistry&&) noexcept = default;
+    CallbackRegistry& operator=(CallbackRegistry&&) noexcept = default;
+
+    template <typename F, typename TCallable = std::decay_t<F>>
+        requires std::is_invocable_v<TCallable&, TArgs...>
+    Subscription subscribe(F&& callback)
+    {
+        ensure_not_invoking();
+
+        const uint32_t handle_index = acquire_handle();
+
+        Slot& slot = slots_.emplace_back();
+        slot.invoke = &invoke_callable<TCallable>;
+        slot.ops = nullptr;
+        slot.handle_index = handle_index;
+
+        try
+        {
+            if constexpr (is_stored_inline<TCallable>)
+            {
+                ::new (static_cast<void*>(slot.state)) TCallable(std::forward<F>(callback));
+                if constexpr (!std::is_trivially_copyable_v<TCallable>)
+                    slot.ops = &ops_for<TCallable>;
+            }
+            else
+            {
+                ::new (static_cast<void*>(slot.state)) TCallable*(new TCallable(std::forward<F>(callback)));
+                slot.ops = &heap_ops_for<TCallable>;
+            }
+        }
+        catch (...)
+        {
+            slots_.pop_back(); // ops == nullptr - nothing to destroy
+            free_handles_.push_back(handle_index);
+            throw;
+        }
+
+        handles_[handle_index].slot_index = static_cast<uint32_t>(slots_.size() - 1);
+
+        return Subscription{handle_index, handles_[handle_index].generation};
+    }
+
+    // returns false for a handle that was already unsubscribed
+    bool unsubscribe(Subscription subscription)
+    {
+        ensure_not_invoking();
+
+        if (!contains(subscription))
+            return false;
+
+        HandleEntry& entry = handles_[subscription.index];
+        const uint32_t slot_index = entry.slot_index;
+
+        if (slot_index != slots_.size() - 1)
+        {
+            slots_[slot_index] = std::move(slots_.back());
+            handles_[slots_[slot_index].handle_index].slot_index = slot_index;
+        }
+        slots_.pop_back();
+
+        entry.slot_index = no_slot;
+        ++entry.generation; // invalidates copies of the handle
+        free_handles_.push_back(subscription.index);
+
+        return true;
+    }
+
+    bool contains(Subscription subscription) const
+    {
+        return subscription.index < handles_.size()
+            && handles_[subscription.index].generation == subscription.generation
+            && handles_[subscription.index].slot_index != no_slot;
+    }
+
+    size_t size() const
+    {
+        return slots_.size();
+    }
+
+    bool empty() const
+    {
+        return slots_.empty();
+    }
+
+    void reserve(size_t capacity)
+    {
+        slots_.reserve(capacity);
+        handles_.reserve(capacity);
+    }
+
+    void operator()(TArgs... args)
+    {
+        InvokingGuard guard{*this};
+
+        for (Slot& slot : slots_)
+            slot.invoke(slot.state, args...);
+    }
+
+    // every callback is invoked for all items - callback by callback, so its state stays in cache
+    template <typename TItem>
+        requires(sizeof...(TArgs) == 1 && std::is_invocable_v<void (*)(TArgs...), const TItem&>)
+    void invoke_batch(std::span<const TItem> items)
+    {
+        InvokingGuard guard{*this};
+
+        for (Slot& slot : slots_)
+        {
+            const auto invoke = slot.invoke;
+            for (const TItem& item : items)
+                invoke(slot.state, item);
+        }
+    }
+
+private:
+    class InvokingGuard
+    {
+        CallbackRegistry& registry_;
+
+    public:
+        explicit InvokingGuard(CallbackRegistry& registry)
+            : registry_{registry}
+        {
+            registry_.ensure_not_invoking();
+            registry_.is_invoking_ = true;
+        }
+
+        InvokingGuard(const InvokingGuard&) = delete;
+        InvokingGuard& operator=(const InvokingGuard&) = delete;
+
+        ~InvokingGuard()
+        {
+            registry_.is_invoking_ = false;
+        }
+    };
+
+    void ensure_not_invoking() const
+    {
+        if (is_invoking_)
+            throw std::logic_error("CallbackRegistry modified or invoked from a callback");
+    }
+
+    uint32_t acquire_handle()
+    {
+        if (!free_handles_.empty())
+        {
+            const uint32_t index = free_handles_.back();
+            free_handles_.pop_back();
+            return index;
+        }
+
+        handles_.push_back(HandleEntry{no_slot, 0});
+        return static_cast<uint32_t>(handles_.size() - 1);
+    }
+};
+
+#endif
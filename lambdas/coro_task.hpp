@@ -0,0 +1,255 @@
+#ifndef CORO_TASK_HPP
+#define CORO_TASK_HPP
+
+#include "task_queue.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+#include <variant>
+
+namespace Coroutines
+{
+    template <typename T = void>
+    class task;
+
+    namespace Details
+    {
+        // resumes the awaiting coroutine when a task finishes - symmetric transfer, no stack growth
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            template <typename TPromise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> coro) noexcept
+            {
+                if (auto continuation = coro.promise().continuation)
+                    return continuation;
+                return std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+        };
+
+        struct PromiseBase
+        {
+            std::coroutine_handle<> continuation;
+
+            std::suspend_always initial_suspend() const noexcept // lazy - starts when awaited
+            {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+        };
+
+        template <typename T>
+        struct Promise : PromiseBase
+        {
+            std::variant<std::monostate, T, std::exception_ptr> result;
+
+            task<T> get_return_object() noexcept;
+
+            template <typename TValue>
+            void return_value(TValue&& value)
+            {
+                result.template emplace<1>(std::forward<TValue>(value));
+            }
+
+            void unhandled_exception() noexcept
+            {
+                result.template emplace<2>(std::current_exception());
+            }
+
+            T get_result()
+            {
+                if (result.index() == 2)
+                    std::rethrow_exception(std::get<2>(result));
+                return std::move(std::get<1>(result));
+            }
+        };
+
+        template <>
+        struct Promise<void> : PromiseBase
+        {
+            std::exception_ptr exception;
+
+            task<void> get_return_object() noexcept;
+
+            void return_void() noexcept
+            {
+            }
+
+            void unhandled_exception() noexcept
+            {
+                exception = std::current_exception();
+            }
+
+            void get_result()
+            {
+                if (exception)
+                    std::rethrow_exception(exception);
+            }
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // task<T> - lazy coroutine returning T
+    //  - starts when co_awaited - the awaiting coroutine becomes its continuation
+    //  - the frame is owned by the task object - when a task is awaited in the scope of its caller
+    //    the compiler may elide the frame allocation (HALO)
+    template <typename T>
+    class [[nodiscard]] task
+    {
+    public:
+        using promise_type = Details::Promise<T>;
+        using handle_type = std::coroutine_handle<promise_type>;
+
+    private:
+        handle_type coro_;
+
+    public:
+        explicit task(handle_type coro) noexcept
+            : coro_{coro}
+        {
+        }
+
+        task(const task&) = delete;
+        task& operator=(const task&) = delete;
+
+        task(task&& other) noexcept
+            : coro_{std::exchange(other.coro_, nullptr)}
+        {
+        }
+
+        task& operator=(task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (coro_)
+                    coro_.destroy();
+                coro_ = std::exchange(other.coro_, nullptr);
+            }
+            return *this;
+        }
+
+        ~task()
+        {
+            if (coro_)
+                coro_.destroy();
+        }
+
+        bool done() const noexcept
+        {
+            return !coro_ || coro_.done();
+        }
+
+        auto operator co_await() && noexcept
+        {
+            struct Awaiter
+            {
+                handle_type coro;
+
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+                {
+                    coro.promise().continuation = awaiting;
+                    return coro;
+                }
+
+                T await_resume()
+                {
+                    return coro.promise().get_result();
+                }
+            };
+
+            return Awaiter{coro_};
+        }
+
+    private:
+        template <typename U>
+        friend U run_to_completion(TaskQueue& queue, task<U> t);
+
+        handle_type handle() const noexcept
+        {
+            return coro_;
+        }
+    };
+
+    template <typename T>
+    task<T> Details::Promise<T>::get_return_object() noexcept
+    {
+        return task<T>{std::coroutine_handle<Promise<T>>::from_promise(*this)};
+    }
+
+    inline task<void> Details::Promise<void>::get_return_object() noexcept
+    {
+        return task<void>{std::coroutine_handle<Promise<void>>::from_promise(*this)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // co_await schedule_on(queue) - suspends the coroutine & resumes it from queue.run()
+    //  - the submitted task captures only the coroutine handle - stored inline in TaskQueue::Task,
+    //    so a hop does not allocate
+    class ScheduleOnAwaiter
+    {
+        TaskQueue& queue_;
+
+    public:
+        explicit ScheduleOnAwaiter(TaskQueue& queue) noexcept
+            : queue_{queue}
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> coro)
+        {
+            queue_.submit([coro] { coro.resume(); });
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+    };
+
+    inline ScheduleOnAwaiter schedule_on(TaskQueue& queue) noexcept
+    {
+        return ScheduleOnAwaiter{queue};
+    }
+
+    // starts the task & runs the queue until the task is completed - returns its result
+    template <typename T>
+    T run_to_completion(TaskQueue& queue, task<T> t)
+    {
+        auto coro = t.handle();
+
+        queue.submit([coro] { coro.resume(); });
+
+        while (!coro.done())
+        {
+            if (queue.run(1) == 0)
+                throw std::logic_error("Task is suspended but the queue is empty");
+        }
+
+        return coro.promise().get_result();
+    }
+}
+
+#endif
@@ -0,0 +1,344 @@
+#ifndef FIND_IF_HPP
+#define FIND_IF_HPP
+
+#include "simd_dispatch.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+namespace Explain
+{
+    template <typename TContainer, typename TPredicate>
+    auto find_if(const TContainer& container, TPredicate pred)
+    {
+        using std::begin;
+        using std::end;
+
+        auto it = begin(container);
+        auto it_end = end(container);
+        for (; it != it_end; ++it)
+            if (pred(*it))
+                return it;
+
+        return it;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // comparison predicates - a lambda is opaque, these tell find_if what is compared
+    //  - find_if(vec, greater_than(10)) - the same result as find_if(vec, [](int n) { return n > 10; })
+    template <typename T, typename TCompare>
+    struct Comparison
+    {
+        using value_type = T;
+        using compare_type = TCompare;
+
+        T value;
+
+        template <typename U>
+        bool operator()(const U& item) const
+        {
+            return TCompare{}(item, value);
+        }
+    };
+
+    template <typename T>
+    auto equal_to(T value)
+    {
+        return Comparison<T, std::equal_to<>>{value};
+    }
+
+    template <typename T>
+    auto not_equal_to(T value)
+    {
+        return Comparison<T, std::not_equal_to<>>{value};
+    }
+
+    template <typename T>
+    auto greater_than(T value)
+    {
+        return Comparison<T, std::greater<>>{value};
+    }
+
+    template <typename T>
+    auto greater_equal(T value)
+    {
+        return Comparison<T, std::greater_equal<>>{value};
+    }
+
+    template <typename T>
+    auto less_than(T value)
+    {
+        return Comparison<T, std::less<>>{value};
+    }
+
+    template <typename T>
+    auto less_equal(T value)
+    {
+        return Comparison<T, std::less_equal<>>{value};
+    }
+
+    namespace Details
+    {
+        template <typename T>
+        struct IsComparison : std::false_type
+        {
+        };
+
+        template <typename T, typename TCompare>
+        struct IsComparison<Comparison<T, TCompare>> : std::true_type
+        {
+        };
+
+        template <typename T, typename TCompare>
+        size_t find_scalar(const T* data, size_t size, T value)
+        {
+            for (size_t i = 0; i < size; ++i)
+                if (TCompare{}(data[i], value))
+                    return i;
+
+            return size;
+        }
+
+#ifdef SIMD_HAS_AVX2_PATH
+        template <typename T>
+        SIMD_TARGET_AVX2 inline __m256i broadcast(T value)
+        {
+            if constexpr (std::is_same_v<T, float>)
+                return _mm256_castps_si256(_mm256_set1_ps(value));
+            else if constexpr (std::is_same_v<T, double>)
+                return _mm256_castpd_si256(_mm256_set1_pd(value));
+            else if constexpr (sizeof(T) == 1)
+                return _mm256_set1_epi8(static_cast<char>(value));
+            else if constexpr (sizeof(T) == 2)
+                return _mm256_set1_epi16(static_cast<short>(value));
+            else if constexpr (sizeof(T) == 4)
+                return _mm256_set1_epi32(static_cast<int>(value));
+            else
+                return _mm256_set1_epi64x(static_cast<long long>(value));
+        }
+
+        template <typename T>
+        SIMD_TARGET_AVX2 inline __m256i compare_eq(__m256i a, __m256i b)
+        {
+            if constexpr (sizeof(T) == 1)
+                return _mm256_cmpeq_epi8(a, b);
+            else if constexpr (sizeof(T) == 2)
+                return _mm256_cmpeq_epi16(a, b);
+            else if constexpr (sizeof(T) == 4)
+                return _mm256_cmpeq_epi32(a, b);
+            else
+                return _mm256_cmpeq_epi64(a, b);
+        }
+
+        template <typename T>
+        SIMD_TARGET_AVX2 inline __m256i compare_gt(__m256i a, __m256i b) // signed
+        {
+            if constexpr (sizeof(T) == 1)
+                return _mm256_cmpgt_epi8(a, b);
+            else if constexpr (sizeof(T) == 2)
+                return _mm256_cmpgt_epi16(a, b);
+            else if constexpr (sizeof(T) == 4)
+                return _mm256_cmpgt_epi32(a, b);
+            else
+                return _mm256_cmpgt_epi64(a, b);
+        }
+
+        SIMD_TARGET_AVX2 inline uint32_t movemask(__m256i result)
+        {
+            return static_cast<uint32_t>(_mm256_movemask_epi8(result));
+        }
+
+        template <typename TCompare>
+        constexpr int float_predicate()
+        {
+            if constexpr (std::is_same_v<TCompare, std::equal_to<>>)
+                return _CMP_EQ_OQ;
+            else if constexpr (std::is_same_v<TCompare, std::not_equal_to<>>)
+                return _CMP_NEQ_UQ; // NaN != x is true
+            else if constexpr (std::is_same_v<TCompare, std::greater<>>)
+                return _CMP_GT_OQ;
+            else if constexpr (std::is_same_v<TCompare, std::greater_equal<>>)
+                return _CMP_GE_OQ;
+            else if constexpr (std::is_same_v<TCompare, std::less<>>)
+                return _CMP_LT_OQ;
+            else
+                return _CMP_LE_OQ;
+        }
+
+        // bit per byte of 32 bytes at ptr - sizeof(T) bits set for every matching item
+        template <typename T, typename TCompare>
+        SIMD_TARGET_AVX2 inline uint32_t match_mask(const T* ptr, __m256i value)
+        {
+            const __m256i items = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const __m256 result = _mm256_cmp_ps(_mm256_castsi256_ps(items), _mm256_castsi256_ps(value), float_predicate<TCompare>());
+                return movemask(_mm256_castps_si256(result));
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                const __m256d result = _mm256_cmp_pd(_mm256_castsi256_pd(items), _mm256_castsi256_pd(value), float_predicate<TCompare>());
+                return movemask(_mm256_castpd_si256(result));
+            }
+            else
+            {
+                __m256i x = items;
+                __m256i v = value;
+
+                if constexpr (std::is_unsigned_v<T>) // AVX2 compares signed integers only
+                {
+                    const __m256i sign_bit = broadcast(static_cast<T>(T{1} << (8 * sizeof(T) - 1)));
+                    x = _mm256_xor_si256(x, sign_bit);
+                    v = _mm256_xor_si256(v, sign_bit);
+                }
+
+                if constexpr (std::is_same_v<TCompare, std::equal_to<>>)
+                    return movemask(compare_eq<T>(x, v));
+                else if constexpr (std::is_same_v<TCompare, std::not_equal_to<>>)
+                    return ~movemask(compare_eq<T>(x, v));
+                else if constexpr (std::is_same_v<TCompare, std::greater<>>)
+                    return movemask(compare_gt<T>(x, v));
+                else if constexpr (std::is_same_v<TCompare, std::less_equal<>>)
+                    return ~movemask(compare_gt<T>(x, v));
+                else if constexpr (std::is_same_v<TCompare, std::less<>>)
+                    return movemask(compare_gt<T>(v, x));
+                else
+                    return ~movemask(compare_gt<T>(v, x));
+            }
+        }
+
+        // 64 bytes per iteration - two 32-byte compares & movemasks
+        template <typename T, typename TCompare>
+        SIMD_TARGET_AVX2 size_t find_avx2(const T* data, size_t size, T value)
+        {
+            constexpr size_t lanes = 32 / sizeof(T);
+
+            const __m256i broadcasted = broadcast(value);
+
+            size_t i = 0;
+            for (; i + 2 * lanes <= size; i += 2 * lanes)
+            {
+                const uint32_t mask_lo = match_mask<T, TCompare>(data + i, broadcasted);
+                const uint32_t mask_hi = match_mask<T, TCompare>(data + i + lanes, broadcasted);
+
+                if ((mask_lo | mask_hi) != 0)
+                {
+                    if (mask_lo != 0)
+                        return i + std::countr_zero(mask_lo) / sizeof(T);
+                    return i + lanes + std::countr_zero(mask_hi) / sizeof(T);
+                }
+            }
+
+            for (; i + lanes <= size; i += lanes)
+            {
+                if (const uint32_t mask = match_mask<T, TCompare>(data + i, broadcasted); mask != 0)
+                    return i + std::countr_zero(mask) / sizeof(T);
+            }
+
+            return i + find_scalar<T, TCompare>(data + i, size - i, value);
+        }
+#endif
+
+        template <typename T, typename TCompare>
+        size_t find_index(const T* data, size_t size, T value)
+        {
+#ifdef SIMD_HAS_AVX2_PATH
+            if (Simd::cpu_has_avx2())
+                return find_avx2<T, TCompare>(data, size, value);
+#endif
+            return find_scalar<T, TCompare>(data, size, value);
+        }
+    }
+
+    template <typename TContainer, typename TPredicate>
+    concept VectorizableSearch = std::ranges::contiguous_range<const TContainer>
+        && std::ranges::sized_range<const TContainer>
+        && Details::IsComparison<TPredicate>::value
+        && std::same_as<std::ranges::range_value_t<const TContainer>, typename TPredicate::value_type> // no implicit conversions of the value
+        && std::is_arithmetic_v<typename TPredicate::value_type>
+        && !std::same_as<typename TPredicate::value_type, bool>;
+
+    // contiguous range of numbers & comparison predicate - SIMD scan (AVX2 when available)
+    template <typename TContainer, typename TPredicate>
+        requires VectorizableSearch<TContainer, TPredicate>
+    auto find_if(const TContainer& container, TPredicate pred)
+    {
+        using T = typename TPredicate::value_type;
+
+        const auto index = Details::find_index<T, typename TPredicate::compare_type>(std::ranges::data(container), std::ranges::size(container), pred.value);
+
+        return std::ranges::begin(container) + index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // parallel_find_if - for huge ranges
+    //  - chunks are claimed in order by pool workers & the calling thread
+    //  - a chunk starting after an already found item is never searched (cooperative cancellation)
+    //  - pred is called concurrently from many threads
+    template <std::ranges::random_access_range TContainer, typename TPredicate>
+    auto parallel_find_if(Concurrency::ThreadPool& pool, const TContainer& container, TPredicate pred, size_t chunk_size = 64 * 1024)
+    {
+        const auto first = std::ranges::begin(container);
+        const auto size = static_cast<size_t>(std::ranges::size(container));
+
+        if (size <= chunk_size || pool.size() == 0)
+            return Explain::find_if(container, pred);
+
+        const size_t no_of_chunks = (size + chunk_size - 1) / chunk_size;
+
+        std::atomic<size_t> next_chunk{0};
+        std::atomic<size_t> found{size};
+
+        auto search = [&] {
+            for (;;)
+            {
+                const size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+                const size_t chunk_begin = chunk * chunk_size;
+
+                if (chunk >= no_of_chunks || chunk_begin >= found.load(std::memory_order_relaxed))
+                    return; // chunks are claimed in order - all remaining chunks start later
+
+                const size_t chunk_end = std::min(chunk_begin + chunk_size, size);
+                const auto chunk_range = std::ranges::subrange(first + chunk_begin, first + chunk_end);
+
+                const auto index = static_cast<size_t>(Explain::find_if(chunk_range, pred) - first);
+                if (index < chunk_end)
+                {
+                    size_t current = found.load(std::memory_order_relaxed);
+                    while (index < current && !found.compare_exchange_weak(current, index, std::memory_order_relaxed))
+                        ;
+                    return;
+                }
+            }
+        };
+
+        const size_t no_of_helpers = std::min(pool.size(), no_of_chunks - 1);
+
+        std::vector<std::future<void>> helpers;
+        helpers.reserve(no_of_helpers);
+        for (size_t i = 0; i < no_of_helpers; ++i)
+            helpers.push_back(pool.submit(search));
+
+        search();
+
+        for (auto& helper : helpers)
+            pool.wait(helper);
+
+        return first + found.load(std::memory_order_relaxed);
+    }
+}
+
+#endif
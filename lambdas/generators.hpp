@@ -0,0 +1,285 @@
+#ifndef GENERATORS_HPP
+#define GENERATORS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace Generators
+{
+    namespace Details
+    {
+        // fixed-size inner loop - vectorized by the compiler (a vector add per block of lanes)
+        template <std::integral T>
+        void fill_sequence(std::span<T> out, T first)
+        {
+            constexpr size_t lanes = 8;
+
+            std::array<T, lanes> block;
+            for (size_t j = 0; j < lanes; ++j)
+                block[j] = static_cast<T>(first + j);
+
+            size_t i = 0;
+            for (; i + lanes <= out.size(); i += lanes)
+            {
+                for (size_t j = 0; j < lanes; ++j)
+                {
+                    out[i + j] = block[j];
+                    block[j] += static_cast<T>(lanes);
+                }
+            }
+
+            for (; i < out.size(); ++i)
+                out[i] = static_cast<T>(first + i);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // IdGenerator - the same sequence as create_generator(seed): seed + 1, seed + 2, ...
+    //  - fill(span) writes a whole buffer at once
+    template <std::integral T>
+    class IdGenerator
+    {
+        T last_;
+
+    public:
+        explicit IdGenerator(T seed)
+            : last_{seed}
+        {
+        }
+
+        T operator()()
+        {
+            return ++last_;
+        }
+
+        void fill(std::span<T> out)
+        {
+            Details::fill_sequence(out, static_cast<T>(last_ + 1));
+            last_ = static_cast<T>(last_ + out.size());
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // ConcurrentIdGenerator - unique ids for many threads
+    //  - every thread takes ids from its own LocalIdGenerator
+    //  - a LocalIdGenerator reserves a block of ids with one fetch_add on the shared counter
+    //  - ids are unique, but not ordered across threads
+    template <std::integral T>
+    class ConcurrentIdGenerator
+    {
+        alignas(64) std::atomic<T> last_;
+        const size_t block_size_;
+
+    public:
+        class LocalIdGenerator
+        {
+            ConcurrentIdGenerator& source_;
+            T next_{};
+            T end_{};
+
+        public:
+            explicit LocalIdGenerator(ConcurrentIdGenerator& source)
+                : source_{source}
+            {
+            }
+
+            T operator()()
+            {
+                if (next_ == end_)
+                    std::tie(next_, end_) = source_.reserve(source_.block_size_);
+
+                return next_++;
+            }
+
+            void fill(std::span<T> out)
+            {
+                // the rest of the current block...
+                const auto from_block = std::min(out.size(), static_cast<size_t>(end_ - next_));
+                Details::fill_sequence(out.first(from_block), next_);
+                next_ = static_cast<T>(next_ + from_block);
+
+                if (from_block == out.size())
+                    return;
+
+                // ...and one block for the remaining ids (at least block_size)
+                const auto rest = out.size() - from_block;
+                const auto [first, end] = source_.reserve(std::max(rest, source_.block_size_));
+                Details::fill_sequence(out.subspan(from_block), first);
+
+                next_ = static_cast<T>(first + rest);
+                end_ = end;
+            }
+        };
+
+        explicit ConcurrentIdGenerator(T seed, size_t block_size = 4096)
+            : last_{seed}
+            , block_size_{block_size}
+        {
+        }
+
+        ConcurrentIdGenerator(const ConcurrentIdGenerator&) = delete;
+        ConcurrentIdGenerator& operator=(const ConcurrentIdGenerator&) = delete;
+
+        LocalIdGenerator local()
+        {
+            return LocalIdGenerator{*this};
+        }
+
+    private:
+        // [first, end) - ids seed + 1, seed + 2, ... like IdGenerator
+        std::pair<T, T> reserve(size_t count)
+        {
+            const T last = last_.fetch_add(static_cast<T>(count), std::memory_order_relaxed);
+            return {static_cast<T>(last + 1), static_cast<T>(last + 1 + count)};
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // generator<T> - lazy range of values produced by a coroutine (like std::generator from C++23)
+    template <typename T>
+    class [[nodiscard]] generator : public std::ranges::view_base
+    {
+    public:
+        struct promise_type
+        {
+            const T* current = nullptr;
+            std::exception_ptr exception;
+
+            generator get_return_object() noexcept
+            {
+                return generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always yield_value(const T& value) noexcept
+            {
+                current = std::addressof(value); // the value lives in the coroutine frame until resumed
+                return {};
+            }
+
+            void return_void() noexcept
+            {
+            }
+
+            void unhandled_exception() noexcept
+            {
+                exception = std::current_exception();
+            }
+
+            template <typename U>
+            std::suspend_never await_transform(U&&) = delete; // no co_await in generators
+        };
+
+        class iterator
+        {
+            std::coroutine_handle<promise_type> coro_;
+
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            explicit iterator(std::coroutine_handle<promise_type> coro)
+                : coro_{coro}
+            {
+            }
+
+            const T& operator*() const
+            {
+                return *coro_.promise().current;
+            }
+
+            iterator& operator++()
+            {
+                coro_.resume();
+                if (coro_.done() && coro_.promise().exception)
+                    std::rethrow_exception(coro_.promise().exception);
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                ++*this;
+            }
+
+            bool operator==(std::default_sentinel_t) const
+            {
+                return !coro_ || coro_.done();
+            }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> coro_;
+
+        explicit generator(std::coroutine_handle<promise_type> coro) noexcept
+            : coro_{coro}
+        {
+        }
+
+    public:
+        generator(generator&& other) noexcept
+            : coro_{std::exchange(other.coro_, nullptr)}
+        {
+        }
+
+        generator& operator=(generator&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (coro_)
+                    coro_.destroy();
+                coro_ = std::exchange(other.coro_, nullptr);
+            }
+            return *this;
+        }
+
+        ~generator()
+        {
+            if (coro_)
+                coro_.destroy();
+        }
+
+        // single pass - begin() starts the coroutine
+        iterator begin()
+        {
+            iterator it{coro_};
+            ++it;
+            return it;
+        }
+
+        std::default_sentinel_t end() const noexcept
+        {
+            return std::default_sentinel;
+        }
+    };
+
+    // infinite lazy sequence: seed + 1, seed + 2, ...
+    template <std::integral T>
+    generator<T> ids(T seed)
+    {
+        for (;;)
+            co_yield ++seed;
+    }
+}
+
+#endif
@@ -1,3 +1,7 @@
+#include "callback_registry.hpp"
+#include "find_if.hpp"
+#include "task_queue.hpp"
+
 #include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
@@ -5,7 +9,6 @@
 #include <utility>
 #include <vector>
 #include <functional>
-#include <queue>
 
 using namespace std;
 
@@ -306,30 +309,15 @@ TEST_CASE("as_const")
 
 /////////////////////////////////////////////////////
 // passing lambdas as function params
-namespace Explain
-{
-    template <typename TContainer, typename TPredicate>
-    auto find_if(const TContainer& container, TPredicate pred)
-    {
-        using std::begin;
-        using std::end;
-
-        auto it = begin(container);
-        auto it_end = end(container);
-        for (; it != it_end; ++it)
-            if (pred(*it))
-                return it;
-
-        return it;
-    }
-}
-
 TEST_CASE("passing lambdas")
 {
     std::vector<int> vec = {1, 2, 3, 42, 5};
 
     auto pos_gt_10 = Explain::find_if(vec, [](int n) { return n > 10; });
     REQUIRE(*pos_gt_10 == 42);
+
+    auto pos_gt_10_simd = Explain::find_if(vec, Explain::greater_than(10)); // comparison predicate - SIMD scan
+    REQUIRE(pos_gt_10_simd == pos_gt_10);
 }
 
 struct Fan
@@ -391,30 +379,22 @@ TEST_CASE("storing lambdas")
         on_temperature_change = [&fan](double temp) { if (temp > 25.0) fan.on(); };
         on_temperature_change(28.4);
     }
-}
 
-struct TaskQueue
-{
-    using Task = std::function<void()>;
+    SECTION("CallbackRegistry - many subscribers")
+    {
+        CallbackRegistry<void(double)> on_temperature_change;
 
-    std::queue<Task> tasks_;
+        Fan fan;
 
-    template<typename TTask>
-    void submit(TTask&& task)
-    {
-        tasks_.push(std::forward<TTask>(task));
-    }
+        auto log_temp = on_temperature_change.subscribe([](double temp) { std::cout << "Current temp: " << temp << "\n"; });
+        on_temperature_change.subscribe([&fan](double temp) { if (temp > 25.0) fan.on(); });
 
-    void run()
-    {
-        while(!tasks_.empty())
-        {
-            Task task = tasks_.front();
-            task();
-            tasks_.pop();
-        }
+        on_temperature_change(28.4);
+
+        on_temperature_change.unsubscribe(log_temp);
+        on_temperature_change(29.1);
     }
-};
+}
 
 void start()
 {
@@ -434,5 +414,8 @@ TEST_CASE("TaskQueue")
     q.submit([fan]() { fan->off(); });
     q.submit([]{ std::cout << "Stop...\n"; });
 
+    auto log_message = std::make_unique<std::string>("Log: fan is off");
+    q.submit([msg = std::move(log_message)] { std::cout << *msg << "\n"; }); // move-only task
+
     q.run();
 }
\ No newline at end of file
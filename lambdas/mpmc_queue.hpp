@@ -0,0 +1,223 @@
+#ifndef MPMC_QUEUE_HPP
+#define MPMC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace Concurrency
+{
+    enum class WaitStrategy
+    {
+        spin,  // spin & yield - lowest latency, burns CPU while waiting
+        futex  // std::atomic::wait/notify (futex on Linux) - sleeps when empty/full
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // BoundedMpmcQueue - Dmitry Vyukov's bounded MPMC queue
+    //  - every slot has a sequence number telling whose turn it is (producer or consumer)
+    //  - producers & consumers contend only on their own index (head/tail on separate cache lines)
+    //  - try_push/try_pop never block, push/pop wait according to TWaitStrategy
+    template <typename T, WaitStrategy TWaitStrategy = WaitStrategy::futex>
+    class BoundedMpmcQueue
+    {
+        static constexpr size_t cache_line_size = 64;
+
+        struct alignas(cache_line_size) Slot
+        {
+            std::atomic<size_t> sequence;
+            alignas(T) std::byte storage[sizeof(T)];
+
+            T& item() noexcept
+            {
+                return *std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+        std::unique_ptr<Slot[]> slots_;
+        const size_t mask_;
+
+        alignas(cache_line_size) std::atomic<size_t> enqueue_pos_{0};
+        alignas(cache_line_size) std::atomic<size_t> dequeue_pos_{0};
+
+        // futex waiting - a notifier wakes all sleepers & clears the flag, so the syscall is paid
+        // once per sleep, not on every push/pop
+        alignas(cache_line_size) std::atomic<uint32_t> items_signal_{0};
+        std::atomic<bool> has_items_waiters_{false};
+        alignas(cache_line_size) std::atomic<uint32_t> space_signal_{0};
+        std::atomic<bool> has_space_waiters_{false};
+
+    public:
+        explicit BoundedMpmcQueue(size_t capacity)
+            : slots_{std::make_unique<Slot[]>(capacity)}
+            , mask_{capacity - 1}
+        {
+            if (capacity < 2 || (capacity & mask_) != 0)
+                throw std::invalid_argument("Capacity must be a power of 2");
+
+            for (size_t i = 0; i < capacity; ++i)
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+        BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+        ~BoundedMpmcQueue()
+        {
+            while (try_pop())
+                ;
+        }
+
+        size_t capacity() const
+        {
+            return mask_ + 1;
+        }
+
+        template <typename... TArgs>
+        bool try_emplace(TArgs&&... args)
+        {
+            size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                Slot& slot = slots_[pos & mask_];
+                const size_t seq = slot.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        ::new (static_cast<void*>(slot.storage)) T(std::forward<TArgs>(args)...);
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        notify(items_signal_, has_items_waiters_);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false; // full
+                }
+                else
+                {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool try_push(const T& item)
+        {
+            return try_emplace(item);
+        }
+
+        bool try_push(T&& item)
+        {
+            return try_emplace(std::move(item));
+        }
+
+        std::optional<T> try_pop()
+        {
+            size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                Slot& slot = slots_[pos & mask_];
+                const size_t seq = slot.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        std::optional<T> result{std::move(slot.item())};
+                        slot.item().~T();
+                        slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                        notify(space_signal_, has_space_waiters_);
+                        return result;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return std::nullopt; // empty
+                }
+                else
+                {
+                    pos = dequeue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // blocks while the queue is full
+        void push(T item)
+        {
+            wait_until(space_signal_, has_space_waiters_, [&] { return try_emplace(std::move(item)); });
+        }
+
+        // blocks while the queue is empty
+        T pop()
+        {
+            std::optional<T> result;
+            wait_until(items_signal_, has_items_waiters_, [&] { return (result = try_pop()).has_value(); });
+
+            return std::move(*result);
+        }
+
+    private:
+        void notify(std::atomic<uint32_t>& signal, std::atomic<bool>& has_waiters)
+        {
+            if constexpr (TWaitStrategy == WaitStrategy::futex)
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst); // pairs with the fence in wait_until()
+
+                if (has_waiters.load(std::memory_order_relaxed) && has_waiters.exchange(false, std::memory_order_relaxed))
+                {
+                    signal.fetch_add(1, std::memory_order_release);
+                    signal.notify_all();
+                }
+            }
+        }
+
+        template <typename TPredicate>
+        void wait_until(std::atomic<uint32_t>& signal, std::atomic<bool>& has_waiters, TPredicate try_operation)
+        {
+            constexpr int spin_count = 64;
+
+            for (int i = 0; i < spin_count; ++i)
+            {
+                if (try_operation())
+                    return;
+            }
+
+            for (;;)
+            {
+                if constexpr (TWaitStrategy == WaitStrategy::futex)
+                {
+                    const uint32_t current_signal = signal.load(std::memory_order_acquire);
+                    has_waiters.store(true, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                    if (try_operation())
+                        return; // the flag stays set - costs at most one spurious notification
+
+                    signal.wait(current_signal, std::memory_order_acquire);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+
+                if (try_operation())
+                    return;
+            }
+        }
+    };
+}
+
+#endif
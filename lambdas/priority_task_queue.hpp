@@ -0,0 +1,220 @@
+#ifndef PRIORITY_TASK_QUEUE_HPP
+#define PRIORITY_TASK_QUEUE_HPP
+
+#include "unique_function.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+enum class Priority : uint8_t
+{
+    high,
+    normal,
+    low
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// PriorityTaskQueue - single-threaded scheduler
+//  - priority classes: a task from a higher class always goes first...
+//  - ...unless a lower class was skipped starvation_limit times in a row (starvation protection)
+//  - within a class: earliest deadline first, FIFO for equal deadlines
+//  - delayed tasks wait in a hashed timer wheel until they are due
+class PriorityTaskQueue
+{
+public:
+    using Task = unique_function<void()>;
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr Clock::time_point no_deadline = Clock::time_point::max();
+
+    struct Options
+    {
+        size_t starvation_limit = 16;
+        Clock::duration timer_tick = std::chrono::milliseconds{1};
+        size_t timer_wheel_size = 256;
+    };
+
+private:
+    static constexpr size_t no_of_priorities = 3;
+
+    struct Entry
+    {
+        Clock::time_point deadline;
+        uint64_t sequence;
+        Task task;
+    };
+
+    struct LaterFirst
+    {
+        bool operator()(const Entry& a, const Entry& b) const
+        {
+            if (a.deadline != b.deadline)
+                return a.deadline > b.deadline;
+            return a.sequence > b.sequence;
+        }
+    };
+
+    struct Timer
+    {
+        Clock::time_point due;
+        uint64_t due_tick;
+        Priority priority;
+        Task task;
+    };
+
+    Options options_;
+    std::array<std::vector<Entry>, no_of_priorities> ready_; // heaps
+    std::array<size_t, no_of_priorities> skipped_{};
+    uint64_t sequence_ = 0;
+
+    std::vector<std::vector<Timer>> timer_wheel_;
+    const Clock::time_point start_time_ = Clock::now();
+    uint64_t current_tick_ = 0;
+    size_t timers_count_ = 0;
+
+public:
+    PriorityTaskQueue()
+        : PriorityTaskQueue{Options{}}
+    {
+    }
+
+    explicit PriorityTaskQueue(Options options)
+        : options_{options}
+        , timer_wheel_(options.timer_wheel_size)
+    {
+    }
+
+    void submit(Task task, Priority priority = Priority::normal, Clock::time_point deadline = no_deadline)
+    {
+        auto& heap = ready_[static_cast<size_t>(priority)];
+        heap.push_back(Entry{deadline, sequence_++, std::move(task)});
+        std::push_heap(heap.begin(), heap.end(), LaterFirst{});
+    }
+
+    // the task becomes ready after delay - its deadline is the due time
+    void submit_after(Clock::duration delay, Task task, Priority priority = Priority::normal)
+    {
+        const auto due = Clock::now() + delay;
+        const uint64_t due_tick = std::max(tick_of(due) + 1, current_tick_ + 1); // never fires early
+
+        timer_wheel_[due_tick % timer_wheel_.size()].push_back(Timer{due, due_tick, priority, std::move(task)});
+        ++timers_count_;
+    }
+
+    // executes up to max_batch ready tasks - returns number of executed tasks
+    size_t run(size_t max_batch = std::numeric_limits<size_t>::max())
+    {
+        size_t executed = 0;
+
+        while (executed < max_batch)
+        {
+            advance_timers(Clock::now());
+
+            auto task = pick_next();
+            if (!task)
+                break;
+
+            (*task)();
+            ++executed;
+        }
+
+        return executed;
+    }
+
+    size_t ready_count() const
+    {
+        size_t count = 0;
+        for (const auto& heap : ready_)
+            count += heap.size();
+        return count;
+    }
+
+    size_t delayed_count() const
+    {
+        return timers_count_;
+    }
+
+    bool empty() const
+    {
+        return ready_count() == 0 && timers_count_ == 0;
+    }
+
+private:
+    uint64_t tick_of(Clock::time_point time) const
+    {
+        return static_cast<uint64_t>((time - start_time_) / options_.timer_tick);
+    }
+
+    void advance_timers(Clock::time_point now)
+    {
+        if (timers_count_ == 0)
+        {
+            current_tick_ = tick_of(now);
+            return;
+        }
+
+        const uint64_t now_tick = tick_of(now);
+        if (now_tick <= current_tick_)
+            return;
+
+        // after a long pause every slot is visited once
+        const uint64_t ticks_to_visit = std::min<uint64_t>(now_tick - current_tick_, timer_wheel_.size());
+
+        for (uint64_t tick = now_tick - ticks_to_visit + 1; tick <= now_tick; ++tick)
+        {
+            auto& slot = timer_wheel_[tick % timer_wheel_.size()];
+
+            // timers due in later revolutions stay in the slot
+            auto not_due = std::stable_partition(slot.begin(), slot.end(), [now_tick](const Timer& timer) { return timer.due_tick > now_tick; });
+
+            for (auto it = not_due; it != slot.end(); ++it)
+                submit(std::move(it->task), it->priority, it->due);
+
+            timers_count_ -= slot.end() - not_due;
+            slot.erase(not_due, slot.end());
+        }
+
+        current_tick_ = now_tick;
+    }
+
+    std::optional<Task> pick_next()
+    {
+        size_t chosen = no_of_priorities;
+
+        for (size_t priority = 0; priority < no_of_priorities; ++priority)
+        {
+            if (ready_[priority].empty())
+                continue;
+
+            if (chosen == no_of_priorities)
+            {
+                chosen = priority;
+            }
+            else if (++skipped_[priority] > options_.starvation_limit)
+            {
+                chosen = priority; // starved class wins
+                break;
+            }
+        }
+
+        if (chosen == no_of_priorities)
+            return std::nullopt;
+
+        skipped_[chosen] = 0;
+
+        auto& heap = ready_[chosen];
+        std::pop_heap(heap.begin(), heap.end(), LaterFirst{});
+        Task task = std::move(heap.back().task);
+        heap.pop_back();
+
+        return task;
+    }
+};
+
+#endif
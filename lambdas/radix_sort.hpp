@@ -0,0 +1,325 @@
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Sorting
+{
+    template <typename T>
+    concept RadixFloat = std::floating_point<T> && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8);
+
+    template <typename T>
+    concept RadixKey = (std::integral<T> && !std::same_as<T, bool>) || RadixFloat<T>;
+
+    // digit_bits argument of radix sorts - 0 selects the width from the key size & the number of items
+    inline constexpr unsigned auto_digit_bits = 0;
+
+    namespace Details
+    {
+        template <typename T>
+        struct UnsignedKeyOf
+        {
+            using type = std::make_unsigned_t<T>;
+        };
+
+        template <RadixFloat T>
+        struct UnsignedKeyOf<T>
+        {
+            using type = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+        };
+
+        template <RadixKey T>
+        using UnsignedKey = typename UnsignedKeyOf<T>::type;
+
+        // unsigned key with the order of values - signed: sign bit flipped,
+        // floats: bits of negative values flipped, sign bit of positive values set (-NaN < -inf < ... < -0.0 < +0.0 < ...)
+        template <RadixKey T>
+        constexpr UnsignedKey<T> ordered_key(T value) noexcept
+        {
+            using Key = UnsignedKey<T>;
+            constexpr unsigned sign_shift = 8 * sizeof(Key) - 1;
+            constexpr Key sign_bit = Key{1} << sign_shift;
+
+            if constexpr (RadixFloat<T>)
+            {
+                const Key bits = std::bit_cast<Key>(value);
+                return bits ^ (static_cast<Key>(Key{0} - (bits >> sign_shift)) | sign_bit);
+            }
+            else if constexpr (std::is_signed_v<T>)
+                return static_cast<Key>(static_cast<Key>(value) ^ sign_bit);
+            else
+                return value;
+        }
+
+        template <RadixKey T>
+        inline size_t digit(T value, unsigned shift, size_t mask) noexcept
+        {
+            return static_cast<size_t>(ordered_key(value) >> shift) & mask;
+        }
+
+        template <RadixKey T>
+        unsigned select_digit_bits(unsigned digit_bits, size_t size)
+        {
+            constexpr unsigned key_bits = 8 * sizeof(T);
+
+            if (digit_bits != auto_digit_bits && digit_bits != 8 && digit_bits != 11 && digit_bits != 16)
+                throw std::invalid_argument("radix sort - digit width must be 8, 11 or 16 bits");
+
+            if (digit_bits == auto_digit_bits)
+            {
+                if constexpr (key_bits == 16)
+                    digit_bits = size >= (size_t{1} << 18) ? 16 : 8; // one pass pays off for 64K buckets
+                else if constexpr (key_bits > 16)
+                    digit_bits = 11; // 2048 buckets - counters fit into L1, scatter targets stay in cache & TLB
+                else
+                    digit_bits = 8;
+            }
+
+            return std::min(digit_bits, key_bits);
+        }
+
+        struct NoValues
+        {
+        };
+
+        // stable LSD passes - items go back & forth between input & buffers, result ends up in the input
+        //  - histograms of all passes are built in one sweep before the first pass
+        //  - a pass in which all keys have the same digit would not move anything & is skipped
+        template <RadixKey K, typename V>
+        void lsd_sort(std::span<K> keys, std::span<V> values, unsigned digit_bits)
+        {
+            constexpr bool has_values = !std::is_same_v<V, NoValues>;
+            constexpr unsigned key_bits = 8 * sizeof(K);
+
+            const size_t size = keys.size();
+            const unsigned no_of_passes = (key_bits + digit_bits - 1) / digit_bits;
+            const size_t radix = size_t{1} << digit_bits;
+            const size_t mask = radix - 1;
+
+            std::vector<size_t> counts(no_of_passes * radix);
+            for (K key : keys)
+                for (unsigned pass = 0; pass < no_of_passes; ++pass)
+                    ++counts[pass * radix + digit(key, pass * digit_bits, mask)];
+
+            std::vector<K> key_buffer(size);
+            std::vector<std::conditional_t<has_values, V, NoValues>> value_buffer(has_values ? size : 0);
+
+            K* key_src = keys.data();
+            K* key_dest = key_buffer.data();
+            [[maybe_unused]] V* value_src = values.data();
+            [[maybe_unused]] V* value_dest = value_buffer.data();
+
+            std::vector<size_t> offsets(radix);
+            for (unsigned pass = 0; pass < no_of_passes; ++pass)
+            {
+                const size_t* count = counts.data() + pass * radix;
+                const unsigned shift = pass * digit_bits;
+
+                if (count[digit(key_src[0], shift, mask)] == size)
+                    continue;
+
+                std::exclusive_scan(count, count + radix, offsets.begin(), size_t{0});
+
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const size_t position = offsets[digit(key_src[i], shift, mask)]++;
+                    key_dest[position] = key_src[i];
+                    if constexpr (has_values)
+                        value_dest[position] = std::move(value_src[i]);
+                }
+
+                std::swap(key_src, key_dest);
+                if constexpr (has_values)
+                    std::swap(value_src, value_dest);
+            }
+
+            if (key_src != keys.data())
+            {
+                std::copy(key_src, key_src + size, keys.data());
+                if constexpr (has_values)
+                    std::move(value_src, value_src + size, values.data());
+            }
+        }
+
+        // below this size comparison sort is faster than clearing & scanning histograms
+        inline constexpr size_t small_sort_threshold = 256;
+
+        template <RadixKey T>
+        void small_sort(std::span<T> values)
+        {
+            std::sort(values.begin(), values.end(), [](T a, T b) { return ordered_key(a) < ordered_key(b); });
+        }
+
+        // chunk 0 runs on the calling thread, others on the pool - returns when all are done
+        template <typename F>
+        void for_each_chunk(Concurrency::ThreadPool& pool, size_t no_of_chunks, F f)
+        {
+            std::vector<std::future<void>> helpers;
+            helpers.reserve(no_of_chunks - 1);
+            for (size_t chunk = 1; chunk < no_of_chunks; ++chunk)
+                helpers.push_back(pool.submit([&f, chunk] { f(chunk); }));
+
+            f(0);
+
+            for (auto& helper : helpers)
+                pool.wait(helper);
+        }
+    }
+
+    template <typename TRange>
+    concept RadixSortableRange = std::ranges::contiguous_range<TRange>
+        && std::ranges::sized_range<TRange>
+        && RadixKey<std::ranges::range_value_t<TRange>>
+        && !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<TRange>>>;
+
+    /////////////////////////////////////////////////////////////////////////////
+    // radix_sort - LSD radix sort of integers & IEEE floats (ascending, stable)
+    //  - digits of 8, 11 or 16 bits (auto_digit_bits: 8 for 1-byte keys, 8/16 for 2-byte keys, 11 otherwise)
+    //  - floats are ordered: -NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN
+    //  - O(n) extra memory - one buffer of the size of the input
+    template <typename TRange>
+        requires RadixSortableRange<TRange>
+    void radix_sort(TRange&& range, unsigned digit_bits = auto_digit_bits)
+    {
+        using T = std::ranges::range_value_t<TRange>;
+        std::span<T> values{std::ranges::data(range), std::ranges::size(range)};
+
+        digit_bits = Details::select_digit_bits<T>(digit_bits, values.size());
+
+        if (values.size() < Details::small_sort_threshold)
+            return Details::small_sort(values);
+
+        Details::lsd_sort(values, std::span<Details::NoValues>{}, digit_bits);
+    }
+
+    // sorts keys & moves values along (stable) - values must be default constructible & movable
+    template <typename TKeys, typename TValues>
+        requires RadixSortableRange<TKeys> && std::ranges::contiguous_range<TValues> && std::ranges::sized_range<TValues>
+    void radix_sort_by_key(TKeys&& keys, TValues&& values, unsigned digit_bits = auto_digit_bits)
+    {
+        using K = std::ranges::range_value_t<TKeys>;
+        using V = std::ranges::range_value_t<TValues>;
+
+        std::span<K> key_span{std::ranges::data(keys), std::ranges::size(keys)};
+        std::span<V> value_span{std::ranges::data(values), std::ranges::size(values)};
+
+        if (key_span.size() != value_span.size())
+            throw std::invalid_argument("radix_sort_by_key - keys & values differ in size");
+
+        digit_bits = Details::select_digit_bits<K>(digit_bits, key_span.size());
+
+        if (key_span.empty())
+            return;
+
+        Details::lsd_sort(key_span, value_span, digit_bits);
+    }
+
+    // indexes of keys in sorted order (stable) - keys are not modified
+    template <typename TRange>
+        requires std::ranges::contiguous_range<TRange> && std::ranges::sized_range<TRange> && RadixKey<std::ranges::range_value_t<TRange>>
+    std::vector<size_t> argsort(const TRange& range, unsigned digit_bits = auto_digit_bits)
+    {
+        std::vector<std::ranges::range_value_t<TRange>> keys(std::ranges::begin(range), std::ranges::end(range));
+        std::vector<size_t> indexes(keys.size());
+        std::iota(indexes.begin(), indexes.end(), size_t{0});
+
+        radix_sort_by_key(keys, indexes, digit_bits);
+
+        return indexes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // parallel_radix_sort - every pass: histograms of chunks in parallel, offsets of (digit, chunk) pairs,
+    // parallel scatter of chunks (stable - chunk i writes before chunk i + 1 within every bucket)
+    template <typename TRange>
+        requires RadixSortableRange<TRange>
+    void parallel_radix_sort(Concurrency::ThreadPool& pool, TRange&& range, unsigned digit_bits = auto_digit_bits, size_t min_chunk_size = 256 * 1024)
+    {
+        using T = std::ranges::range_value_t<TRange>;
+        std::span<T> values{std::ranges::data(range), std::ranges::size(range)};
+
+        const size_t size = values.size();
+        const size_t no_of_chunks = std::min(pool.size() + 1, size / std::max<size_t>(min_chunk_size, 1));
+
+        if (no_of_chunks <= 1)
+            return radix_sort(values, digit_bits);
+
+        digit_bits = Details::select_digit_bits<T>(digit_bits, size);
+
+        constexpr unsigned key_bits = 8 * sizeof(T);
+        const unsigned no_of_passes = (key_bits + digit_bits - 1) / digit_bits;
+        const size_t radix = size_t{1} << digit_bits;
+        const size_t mask = radix - 1;
+        const size_t chunk_size = (size + no_of_chunks - 1) / no_of_chunks;
+
+        std::vector<T> buffer(size);
+        T* src = values.data();
+        T* dest = buffer.data();
+
+        std::vector<size_t> counts(no_of_chunks * radix); // [chunk][digit]
+        std::vector<size_t> totals(radix);
+
+        for (unsigned pass = 0; pass < no_of_passes; ++pass)
+        {
+            const unsigned shift = pass * digit_bits;
+
+            Details::for_each_chunk(pool, no_of_chunks, [&](size_t chunk) {
+                size_t* count = counts.data() + chunk * radix;
+                std::fill(count, count + radix, size_t{0});
+
+                const size_t chunk_end = std::min(size, (chunk + 1) * chunk_size);
+                for (size_t i = chunk * chunk_size; i < chunk_end; ++i)
+                    ++count[Details::digit(src[i], shift, mask)];
+            });
+
+            std::fill(totals.begin(), totals.end(), size_t{0});
+            for (size_t chunk = 0; chunk < no_of_chunks; ++chunk)
+                for (size_t d = 0; d < radix; ++d)
+                    totals[d] += counts[chunk * radix + d];
+
+            if (totals[Details::digit(src[0], shift, mask)] == size)
+                continue;
+
+            // counts become offsets: start of the bucket + items of the digit in preceding chunks
+            size_t bucket_start = 0;
+            for (size_t d = 0; d < radix; ++d)
+            {
+                size_t offset = bucket_start;
+                for (size_t chunk = 0; chunk < no_of_chunks; ++chunk)
+                    offset += std::exchange(counts[chunk * radix + d], offset);
+                bucket_start += totals[d];
+            }
+
+            Details::for_each_chunk(pool, no_of_chunks, [&](size_t chunk) {
+                size_t* offsets = counts.data() + chunk * radix;
+
+                const size_t chunk_end = std::min(size, (chunk + 1) * chunk_size);
+                for (size_t i = chunk * chunk_size; i < chunk_end; ++i)
+                    dest[offsets[Details::digit(src[i], shift, mask)]++] = src[i];
+            });
+
+            std::swap(src, dest);
+        }
+
+        if (src != values.data())
+            std::copy(src, src + size, values.data());
+    }
+}
+
+#endif
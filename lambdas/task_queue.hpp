@@ -0,0 +1,225 @@
+#ifndef TASK_QUEUE_HPP
+#define TASK_QUEUE_HPP
+
+#include "unique_function.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+// default tracing policy of TaskQueue - compiles to nothing
+struct NoTracing
+{
+    static constexpr bool enabled = false;
+
+    struct Stamp
+    {
+    };
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// BasicTaskQueue - single-threaded FIFO of tasks
+//  - tasks are constructed in place in a ring buffer & executed in place - no copies, no moves
+//  - the buffer grows (x2) when full - tasks may submit new tasks while running
+//  - run() is not reentrant
+//  - TTracer::enabled == true: enqueue/start/stop times & queue depth of every task are recorded
+//    by the tracer (see task_tracer.hpp)
+template <typename TTracer = NoTracing>
+class BasicTaskQueue
+{
+public:
+    using Task = unique_function<void()>; // move-only - accepts lambdas capturing unique_ptr
+
+private:
+    using Stamp = typename TTracer::Stamp;
+
+    struct Slot
+    {
+        alignas(Task) std::byte data[sizeof(Task)];
+        [[no_unique_address]] Stamp enqueued;
+    };
+
+    [[no_unique_address]] std::conditional_t<TTracer::enabled, TTracer*, TTracer> tracer_{};
+    std::unique_ptr<Slot[]> buffer_;
+    std::unique_ptr<Slot[]> running_task_buffer_; // kept alive if the buffer grows while a task is running
+    size_t capacity_ = 0;
+    size_t head_ = 0;
+    size_t count_ = 0;
+    bool is_running_ = false;
+
+public:
+    explicit BasicTaskQueue(size_t initial_capacity = 16)
+        requires(!TTracer::enabled)
+    {
+        reserve(initial_capacity);
+    }
+
+    explicit BasicTaskQueue(TTracer& tracer, size_t initial_capacity = 16)
+        requires TTracer::enabled
+        : tracer_{&tracer}
+    {
+        reserve(initial_capacity);
+    }
+
+    BasicTaskQueue(const BasicTaskQueue&) = delete;
+    BasicTaskQueue& operator=(const BasicTaskQueue&) = delete;
+
+    ~BasicTaskQueue()
+    {
+        while (count_ > 0)
+        {
+            task_at(head_)->~Task();
+            head_ = (head_ + 1) & (capacity_ - 1);
+            --count_;
+        }
+    }
+
+    template <typename TTask>
+    void submit(TTask&& task)
+    {
+        reserve(count_ + 1);
+
+        Slot& slot = slot_at(head_ + count_);
+        ::new (static_cast<void*>(slot.data)) Task(std::forward<TTask>(task));
+        if constexpr (TTracer::enabled)
+            slot.enqueued = tracer_->now();
+        ++count_;
+    }
+
+    // elements are forwarded by their own reference type - tasks are copied from containers & views over them,
+    // moved only from ranges of rvalues (e.g. a subrange of std::move_iterator)
+    template <std::ranges::input_range TRange>
+    void submit_bulk(TRange&& tasks)
+    {
+        if constexpr (std::ranges::sized_range<TRange>)
+            reserve(count_ + std::ranges::size(tasks));
+
+        for (auto&& task : tasks)
+            submit(std::forward<decltype(task)>(task));
+    }
+
+    // executes up to max_batch tasks - returns number of executed tasks
+    size_t run(size_t max_batch = std::numeric_limits<size_t>::max())
+    {
+        size_t executed = 0;
+
+        while (count_ > 0 && executed < max_batch)
+        {
+            Task* task = task_at(head_);
+            [[maybe_unused]] const Stamp enqueued = slot_at(head_).enqueued;
+            [[maybe_unused]] const size_t queue_depth = count_;
+            head_ = (head_ + 1) & (capacity_ - 1);
+            --count_;
+
+            RunningTaskGuard guard{*this, task};
+
+            if constexpr (TTracer::enabled)
+            {
+                const Stamp started = tracer_->now();
+                (*task)();
+                tracer_->record(enqueued, started, tracer_->now(), queue_depth); // tasks that throw are not recorded
+            }
+            else
+            {
+                (*task)();
+            }
+
+            ++executed;
+        }
+
+        return executed;
+    }
+
+    size_t size() const
+    {
+        return count_;
+    }
+
+    bool empty() const
+    {
+        return count_ == 0;
+    }
+
+    size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    void reserve(size_t new_size)
+    {
+        // the slot of a running task is still occupied
+        const size_t required = new_size + (is_running_ ? 1 : 0);
+
+        if (required <= capacity_)
+            return;
+
+        size_t new_capacity = capacity_ ? capacity_ : 1;
+        while (new_capacity < required)
+            new_capacity *= 2;
+
+        grow(new_capacity);
+    }
+
+private:
+    class RunningTaskGuard
+    {
+        BasicTaskQueue& queue_;
+        Task* task_;
+
+    public:
+        RunningTaskGuard(BasicTaskQueue& queue, Task* task)
+            : queue_{queue}
+            , task_{task}
+        {
+            queue_.is_running_ = true;
+        }
+
+        RunningTaskGuard(const RunningTaskGuard&) = delete;
+        RunningTaskGuard& operator=(const RunningTaskGuard&) = delete;
+
+        ~RunningTaskGuard()
+        {
+            task_->~Task();
+            queue_.is_running_ = false;
+            queue_.running_task_buffer_.reset();
+        }
+    };
+
+    Slot& slot_at(size_t index) const
+    {
+        return buffer_[index & (capacity_ - 1)];
+    }
+
+    Task* task_at(size_t index) const
+    {
+        return std::launder(reinterpret_cast<Task*>(slot_at(index).data));
+    }
+
+    void grow(size_t new_capacity)
+    {
+        auto new_buffer = std::make_unique<Slot[]>(new_capacity);
+
+        for (size_t i = 0; i < count_; ++i)
+        {
+            Task* task = task_at(head_ + i);
+            ::new (static_cast<void*>(new_buffer[i].data)) Task(std::move(*task));
+            new_buffer[i].enqueued = slot_at(head_ + i).enqueued;
+            task->~Task();
+        }
+
+        if (is_running_ && !running_task_buffer_)
+            running_task_buffer_ = std::move(buffer_);
+
+        buffer_ = std::move(new_buffer);
+        capacity_ = new_capacity;
+        head_ = 0;
+    }
+};
+
+using TaskQueue = BasicTaskQueue<>;
+
+#endif
@@ -0,0 +1,180 @@
+#ifndef TASK_TRACER_HPP
+#define TASK_TRACER_HPP
+
+#include "task_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////
+// TaskTracer - collects trace events of BasicTaskQueue<TaskTracer>
+//  - every thread records into its own fixed-size buffer (single writer - no locks, no CAS)
+//  - events are dropped (and counted) when a thread's buffer is full
+//  - events() & write_chrome_trace() may be called while queues are still running
+class TaskTracer
+{
+public:
+    static constexpr bool enabled = true;
+
+    using Clock = std::chrono::steady_clock;
+    using Stamp = Clock::time_point;
+
+    struct Event
+    {
+        Stamp enqueued;
+        Stamp started;
+        Stamp finished;
+        size_t queue_depth; // tasks waiting in the queue when the task was dequeued (including itself)
+        uint32_t thread_index;
+    };
+
+private:
+    struct ThreadBuffer
+    {
+        std::unique_ptr<Event[]> events;
+        std::atomic<size_t> size{0};
+        std::atomic<size_t> dropped{0};
+        uint32_t thread_index;
+
+        ThreadBuffer(size_t capacity, uint32_t index)
+            : events{std::make_unique<Event[]>(capacity)}
+            , thread_index{index}
+        {
+        }
+    };
+
+    const size_t events_per_thread_;
+    const uint64_t id_;
+    const Stamp origin_ = Clock::now();
+
+    mutable std::mutex mtx_buffers_;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+
+public:
+    explicit TaskTracer(size_t events_per_thread = 64 * 1024)
+        : events_per_thread_{events_per_thread}
+        , id_{next_id()}
+    {
+    }
+
+    TaskTracer(const TaskTracer&) = delete;
+    TaskTracer& operator=(const TaskTracer&) = delete;
+
+    Stamp now() const
+    {
+        return Clock::now();
+    }
+
+    void record(Stamp enqueued, Stamp started, Stamp finished, size_t queue_depth)
+    {
+        ThreadBuffer& buffer = local_buffer();
+
+        const size_t size = buffer.size.load(std::memory_order_relaxed);
+        if (size == events_per_thread_)
+        {
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        buffer.events[size] = Event{enqueued, started, finished, queue_depth, buffer.thread_index};
+        buffer.size.store(size + 1, std::memory_order_release); // publishes the event
+    }
+
+    std::vector<Event> events() const
+    {
+        std::vector<Event> result;
+
+        std::lock_guard lk{mtx_buffers_};
+        for (const auto& buffer : buffers_)
+        {
+            const size_t size = buffer->size.load(std::memory_order_acquire);
+            result.insert(result.end(), buffer->events.get(), buffer->events.get() + size);
+        }
+
+        return result;
+    }
+
+    size_t dropped_count() const
+    {
+        size_t dropped = 0;
+
+        std::lock_guard lk{mtx_buffers_};
+        for (const auto& buffer : buffers_)
+            dropped += buffer->dropped.load(std::memory_order_relaxed);
+
+        return dropped;
+    }
+
+    // Chrome trace-event format - open in chrome://tracing or ui.perfetto.dev
+    //  - a complete event ("X") per task with its queue wait time
+    //  - a counter event ("C") with the queue depth
+    void write_chrome_trace(std::ostream& out) const
+    {
+        auto to_us = [this](Stamp stamp) { return std::chrono::duration<double, std::micro>(stamp - origin_).count(); };
+
+        const auto flags = out.flags();
+        out.setf(std::ios::fixed);
+        const auto precision = out.precision(3);
+
+        out << R"({"traceEvents":[)";
+
+        bool first = true;
+        for (const Event& e : events())
+        {
+            out << (first ? "\n" : ",\n");
+            first = false;
+
+            out << R"({"name":"task","cat":"TaskQueue","ph":"X","pid":1,"tid":)" << e.thread_index
+                << R"(,"ts":)" << to_us(e.started)
+                << R"(,"dur":)" << to_us(e.finished) - to_us(e.started)
+                << R"(,"args":{"queue_wait_us":)" << to_us(e.started) - to_us(e.enqueued)
+                << R"(,"queue_depth":)" << e.queue_depth << "}},\n";
+
+            out << R"({"name":"queue depth","ph":"C","pid":1,"tid":)" << e.thread_index
+                << R"(,"ts":)" << to_us(e.started)
+                << R"(,"args":{"depth":)" << e.queue_depth << "}}";
+        }
+
+        out << "\n]}\n";
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+private:
+    static uint64_t next_id()
+    {
+        static std::atomic<uint64_t> id{0};
+        return ++id;
+    }
+
+    ThreadBuffer& local_buffer()
+    {
+        // ids are never reused - entries of destroyed tracers are never matched
+        thread_local std::vector<std::pair<uint64_t, ThreadBuffer*>> thread_buffers;
+
+        for (const auto& [tracer_id, buffer] : thread_buffers)
+        {
+            if (tracer_id == id_)
+                return *buffer;
+        }
+
+        std::lock_guard lk{mtx_buffers_};
+        const auto index = static_cast<uint32_t>(buffers_.size());
+        buffers_.push_back(std::make_unique<ThreadBuffer>(events_per_thread_, index));
+        thread_buffers.emplace_back(id_, buffers_.back().get());
+
+        return *buffers_.back();
+    }
+};
+
+using TracedTaskQueue = BasicTaskQueue<TaskTracer>;
+
+#endif
@@ -0,0 +1,149 @@
+#include "callback_registry.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("CallbackRegistry")
+{
+    CallbackRegistry<void(double)> on_temperature_change;
+    std::vector<std::string> log;
+
+    auto threshold_alarm = [&log](double limit) {
+        return [&log, limit](double temp) {
+            if (temp > limit)
+                log.push_back("alarm: " + std::to_string(static_cast<int>(limit)));
+        };
+    };
+
+    auto alarm_25 = on_temperature_change.subscribe(threshold_alarm(25.0));
+    auto alarm_30 = on_temperature_change.subscribe(threshold_alarm(30.0));
+
+    REQUIRE(on_temperature_change.size() == 2);
+
+    SECTION("all subscribers are invoked")
+    {
+        on_temperature_change(28.4);
+        REQUIRE(log == std::vector<std::string>{"alarm: 25"});
+
+        on_temperature_change(31.0);
+        REQUIRE(log.size() == 3);
+    }
+
+    SECTION("unsubscribe")
+    {
+        REQUIRE(on_temperature_change.unsubscribe(alarm_25));
+        REQUIRE_FALSE(on_temperature_change.contains(alarm_25));
+        REQUIRE(on_temperature_change.contains(alarm_30));
+
+        on_temperature_change(31.0);
+        REQUIRE(log == std::vector<std::string>{"alarm: 30"});
+
+        SECTION("stale handle is rejected - even when its entry is reused")
+        {
+            auto alarm_20 = on_temperature_change.subscribe(threshold_alarm(20.0));
+
+            REQUIRE(alarm_20.index == alarm_25.index);
+            REQUIRE_FALSE(on_temperature_change.unsubscribe(alarm_25));
+            REQUIRE(on_temperature_change.size() == 2);
+        }
+    }
+
+    SECTION("batch of readings")
+    {
+        std::array readings = {20.0, 26.0, 32.0};
+        on_temperature_change.invoke_batch(std::span<const double>{readings});
+
+        REQUIRE(log.size() == 3); // 26 & 32 for alarm_25, 32 for alarm_30
+    }
+
+    SECTION("modification from a callback is an error")
+    {
+        on_temperature_change.subscribe([&](double) { on_temperature_change.subscribe([](double) {}); });
+
+        REQUIRE_THROWS_AS(on_temperature_change(20.0), std::logic_error);
+    }
+}
+
+TEST_CASE("CallbackRegistry - callables with non-trivial & large state")
+{
+    CallbackRegistry<void(int), 32> registry;
+
+    auto counter = std::make_shared<int>(0);
+    std::array<int, 64> large_state{};
+    large_state.back() = 1;
+
+    std::vector<CallbackRegistry<void(int), 32>::Subscription> subscriptions;
+    for (int i = 0; i < 100; ++i) // slots are relocated when the array grows
+    {
+        if (i % 2 == 0)
+            subscriptions.push_back(registry.subscribe([counter](int n) { *counter += n; }));
+        else
+            subscriptions.push_back(registry.subscribe([counter, large_state](int n) { *counter += n * large_state.back(); }));
+    }
+
+    REQUIRE(counter.use_count() == 101);
+
+    registry(1);
+    REQUIRE(*counter == 100);
+
+    for (size_t i = 0; i < subscriptions.size(); i += 3) // gaps are filled with the last slots
+        registry.unsubscribe(subscriptions[i]);
+
+    REQUIRE(counter.use_count() == 1 + 66);
+
+    *counter = 0;
+    registry(1);
+    REQUIRE(*counter == 66);
+
+    registry = CallbackRegistry<void(int), 32>{};
+    REQUIRE(counter.use_count() == 1);
+}
+
+TEST_CASE("CallbackRegistry vs vector<std::function>", "[.][benchmark]")
+{
+    constexpr int no_of_subscribers = 1'000;
+    constexpr size_t no_of_readings = 256;
+
+    std::vector<double> readings(no_of_readings);
+    std::iota(readings.begin(), readings.end(), 0.0);
+
+    std::vector<double> sums(no_of_subscribers);
+
+    auto make_subscriber = [&sums](int i) {
+        return [sum = &sums[i], factor = 1.0 + i % 7](double temp) { *sum += temp * factor; };
+    };
+
+    std::vector<std::function<void(double)>> functions;
+    CallbackRegistry<void(double)> registry;
+
+    for (int i = 0; i < no_of_subscribers; ++i)
+    {
+        functions.push_back(make_subscriber(i));
+        registry.subscribe(make_subscriber(i));
+    }
+
+    BENCHMARK("vector<std::function> - reading by reading")
+    {
+        for (double temp : readings)
+            for (auto& f : functions)
+                f(temp);
+    };
+
+    BENCHMARK("CallbackRegistry - reading by reading")
+    {
+        for (double temp : readings)
+            registry(temp);
+    };
+
+    BENCHMARK("CallbackRegistry - invoke_batch")
+    {
+        registry.invoke_batch(std::span<const double>{readings});
+    };
+}
@@ -0,0 +1,166 @@
+#include "coro_task.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Coroutines;
+
+namespace
+{
+    struct Device
+    {
+        std::vector<std::string>& log;
+        bool is_on = false;
+
+        task<bool> on(TaskQueue& q)
+        {
+            co_await schedule_on(q);
+            log.push_back("fan on");
+            is_on = true;
+            co_return is_on;
+        }
+
+        task<bool> off(TaskQueue& q)
+        {
+            co_await schedule_on(q);
+            log.push_back("fan off");
+            is_on = false;
+            co_return is_on;
+        }
+    };
+
+    task<int> answer()
+    {
+        co_return 42;
+    }
+
+    task<int> add_answers(TaskQueue& q)
+    {
+        int sum = co_await answer();
+        co_await schedule_on(q);
+        sum += co_await answer();
+        co_return sum;
+    }
+
+    task<> fail(TaskQueue& q)
+    {
+        co_await schedule_on(q);
+        throw std::runtime_error("ERROR");
+    }
+}
+
+TEST_CASE("task<T> scheduled on TaskQueue")
+{
+    TaskQueue q;
+
+    SECTION("awaiting other tasks")
+    {
+        REQUIRE(run_to_completion(q, add_answers(q)) == 84);
+        REQUIRE(q.empty());
+    }
+
+    SECTION("chain of tasks - start -> fan on -> fan off -> stop")
+    {
+        std::vector<std::string> log;
+        Device fan{log};
+
+        auto chain = [&]() -> task<std::string> {
+            log.push_back("start");
+
+            bool is_on = co_await fan.on(q);
+            REQUIRE(is_on);
+
+            is_on = co_await fan.off(q);
+            REQUIRE_FALSE(is_on);
+
+            log.push_back("stop");
+            co_return "Log: fan is off";
+        };
+
+        REQUIRE(run_to_completion(q, chain()) == "Log: fan is off");
+        REQUIRE(log == std::vector<std::string>{"start", "fan on", "fan off", "stop"});
+    }
+
+    SECTION("coroutines interleave on a queue")
+    {
+        std::vector<int> log;
+
+        auto worker = [&](int id) -> task<> {
+            for (int i = 0; i < 3; ++i)
+            {
+                log.push_back(id);
+                co_await schedule_on(q);
+            }
+        };
+
+        auto main_task = [&]() -> task<> {
+            auto w1 = worker(1);
+            auto w2 = worker(2);
+
+            q.submit([&] { log.push_back(0); });
+            co_await std::move(w1);
+            co_await std::move(w2);
+        };
+
+        run_to_completion(q, main_task());
+
+        REQUIRE(log == std::vector{1, 0, 1, 1, 2, 2, 2});
+    }
+
+    SECTION("exceptions are propagated to the awaiting coroutine")
+    {
+        REQUIRE_THROWS_AS(run_to_completion(q, fail(q)), std::runtime_error);
+    }
+
+    SECTION("coroutine may capture move-only state")
+    {
+        auto msg = std::make_unique<std::string>("Log: fan is off");
+
+        auto log_task = [](TaskQueue& q, std::unique_ptr<std::string> msg) -> task<std::string> {
+            co_await schedule_on(q);
+            co_return *msg;
+        };
+
+        REQUIRE(run_to_completion(q, log_task(q, std::move(msg))) == "Log: fan is off");
+    }
+}
+
+TEST_CASE("coroutine hop vs std::function submission", "[.][benchmark]")
+{
+    constexpr int no_of_hops = 10'000;
+
+    BENCHMARK("std::function - task submitting next task")
+    {
+        TaskQueue q;
+        int counter = 0;
+
+        std::function<void()> step = [&] {
+            if (++counter < no_of_hops)
+                q.submit(step); // copies the std::function (and its captured state)
+        };
+
+        q.submit(step);
+        q.run();
+
+        return counter;
+    };
+
+    BENCHMARK("coroutine - co_await schedule_on(q)")
+    {
+        TaskQueue q;
+
+        auto hops = [&q]() -> task<int> {
+            int counter = 0;
+            while (++counter < no_of_hops)
+                co_await schedule_on(q);
+            co_return counter;
+        };
+
+        return run_to_completion(q, hops());
+    };
+}
@@ -0,0 +1,157 @@
+#include "find_if.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    std::vector<T> random_values(size_t size, unsigned seed)
+    {
+        std::mt19937_64 rnd{seed};
+        std::vector<T> values(size);
+
+        for (auto& value : values)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+                value = static_cast<T>(std::uniform_real_distribution<double>{-100.0, 100.0}(rnd));
+            else
+                value = static_cast<T>(rnd()); // whole range - including negative & above the signed maximum
+        }
+
+        return values;
+    }
+
+    template <typename TContainer, typename TPredicate>
+    void check_same_as_std_find_if(const TContainer& values, TPredicate pred)
+    {
+        auto expected = std::find_if(values.begin(), values.end(), pred);
+        auto found = Explain::find_if(values, pred);
+
+        REQUIRE(found - values.begin() == expected - values.begin());
+    }
+}
+
+TEMPLATE_TEST_CASE("Explain::find_if with comparison predicates", "[find_if]",
+    int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double)
+{
+    using namespace Explain;
+
+    for (size_t size : {0, 1, 7, 31, 32, 33, 64, 65, 100, 257})
+    {
+        const auto values = random_values<TestType>(size, static_cast<unsigned>(size));
+        const TestType pivot = size > 0 ? values[size / 2] : TestType{};
+
+        check_same_as_std_find_if(values, equal_to(pivot));
+        check_same_as_std_find_if(values, not_equal_to(values.empty() ? pivot : values.front()));
+        check_same_as_std_find_if(values, greater_than(pivot));
+        check_same_as_std_find_if(values, greater_equal(pivot));
+        check_same_as_std_find_if(values, less_than(pivot));
+        check_same_as_std_find_if(values, less_equal(pivot));
+    }
+
+    SECTION("no match - end")
+    {
+        std::vector<TestType> values(100, TestType{1});
+
+        REQUIRE(Explain::find_if(values, greater_than(TestType{1})) == values.end());
+    }
+}
+
+TEST_CASE("Explain::find_if - edge cases")
+{
+    using namespace Explain;
+
+    SECTION("NaN")
+    {
+        std::vector<double> values(40, 1.0);
+        values[37] = std::nan("");
+
+        REQUIRE(Explain::find_if(values, not_equal_to(1.0)) - values.begin() == 37);
+        REQUIRE(Explain::find_if(values, greater_equal(2.0)) == values.end());
+    }
+
+    SECTION("C array")
+    {
+        int values[] = {1, 2, 3, 42, 5};
+
+        REQUIRE(*Explain::find_if(values, greater_than(10)) == 42);
+    }
+
+    SECTION("non-contiguous range & lambdas use the generic version")
+    {
+        std::list<int> values = {1, 2, 3, 42, 5};
+
+        REQUIRE(*Explain::find_if(values, greater_than(10)) == 42);
+        REQUIRE(*Explain::find_if(values, [](int n) { return n > 10; }) == 42);
+    }
+}
+
+TEST_CASE("Explain::parallel_find_if")
+{
+    Concurrency::ThreadPool pool{4};
+
+    constexpr size_t size = 1'000'000;
+    constexpr size_t chunk_size = 1'000;
+
+    std::vector<int> values(size, 0);
+
+    for (size_t position : {size_t{0}, size_t{999}, size_t{1000}, size / 2, size - 1})
+    {
+        values[position] = 42;
+        values[size - 1] = 42; // later match must not win
+
+        REQUIRE(Explain::parallel_find_if(pool, values, Explain::greater_than(10), chunk_size) - values.begin() == static_cast<std::ptrdiff_t>(position));
+        REQUIRE(*Explain::parallel_find_if(pool, values, [](int n) { return n == 42; }, chunk_size) == 42);
+
+        values[position] = 0;
+    }
+
+    values[size - 1] = 0;
+    REQUIRE(Explain::parallel_find_if(pool, values, Explain::greater_than(10), chunk_size) == values.end());
+}
+
+TEST_CASE("find_if - scalar vs SIMD vs parallel", "[.][benchmark]")
+{
+    Concurrency::ThreadPool pool;
+
+    // 1G ints do not fit in memory of a typical CI runner - 64M (256 MB) is the largest case
+    for (size_t size : {1'000, 1'000'000, 64'000'000})
+    {
+        std::vector<int> values(size, 1);
+
+        for (double hit_at : {0.1, 0.5, 1.0})
+        {
+            const auto position = std::min(static_cast<size_t>(hit_at * size), size - 1);
+            values[position] = 42;
+
+            const std::string title = " - size: " + std::to_string(size) + ", hit at: " + std::to_string(static_cast<int>(hit_at * 100)) + "%";
+
+            BENCHMARK("std::find_if + lambda" + title)
+            {
+                return std::find_if(values.begin(), values.end(), [](int n) { return n > 10; });
+            };
+
+            BENCHMARK("Explain::find_if + greater_than" + title)
+            {
+                return Explain::find_if(values, Explain::greater_than(10));
+            };
+
+            BENCHMARK("Explain::parallel_find_if + greater_than" + title)
+            {
+                return Explain::parallel_find_if(pool, values, Explain::greater_than(10));
+            };
+
+            values[position] = 1;
+        }
+    }
+}
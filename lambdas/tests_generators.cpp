@@ -0,0 +1,204 @@
+#include "generators.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Generators;
+
+TEST_CASE("IdGenerator")
+{
+    IdGenerator<int> gen{1000};
+
+    SECTION("one id per call - like create_generator")
+    {
+        std::vector<int> vec(10);
+        std::generate_n(vec.begin(), vec.size(), std::ref(gen));
+
+        REQUIRE(vec == std::vector{1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010});
+    }
+
+    SECTION("fill(span) - bulk mode")
+    {
+        std::vector<int> vec(21); // not a multiple of the block size
+
+        gen.fill(vec);
+        REQUIRE(vec.front() == 1001);
+        REQUIRE(vec.back() == 1021);
+        REQUIRE(std::ranges::adjacent_find(vec, [](int a, int b) { return b != a + 1; }) == vec.end());
+
+        REQUIRE(gen() == 1022);
+
+        gen.fill(std::span{vec}.first(3));
+        REQUIRE(std::vector(vec.begin(), vec.begin() + 3) == std::vector{1023, 1024, 1025});
+    }
+}
+
+TEST_CASE("ConcurrentIdGenerator")
+{
+    SECTION("single thread - sequence")
+    {
+        ConcurrentIdGenerator<int64_t> source{0, 4};
+        auto gen = source.local();
+
+        std::vector<int64_t> vec(10);
+        gen.fill(std::span{vec}.first(3));  // reserves [1, 5)
+        gen.fill(std::span{vec}.subspan(3)); // rest of the block + [5, 9)
+
+        REQUIRE(vec == std::vector<int64_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+        REQUIRE(gen() == 11);
+    }
+
+    SECTION("many threads - ids are unique")
+    {
+        ConcurrentIdGenerator<uint64_t> source{0, 64};
+
+        constexpr int no_of_threads = 4;
+        constexpr size_t ids_per_thread = 10'000;
+
+        std::vector<std::vector<uint64_t>> ids(no_of_threads, std::vector<uint64_t>(ids_per_thread));
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < no_of_threads; ++t)
+        {
+            threads.emplace_back([&source, &ids = ids[t], t] {
+                auto gen = source.local();
+                if (t % 2 == 0)
+                    std::generate(ids.begin(), ids.end(), std::ref(gen));
+                else
+                {
+                    for (size_t i = 0; i < ids.size(); i += 100)
+                        gen.fill(std::span{ids}.subspan(i, 100));
+                }
+            });
+        }
+
+        for (auto& thd : threads)
+            thd.join();
+
+        std::vector<uint64_t> all_ids;
+        for (const auto& thread_ids : ids)
+            all_ids.insert(all_ids.end(), thread_ids.begin(), thread_ids.end());
+
+        std::ranges::sort(all_ids);
+        REQUIRE(std::ranges::adjacent_find(all_ids) == all_ids.end());
+    }
+}
+
+TEST_CASE("generator<T> - lazy range")
+{
+    SECTION("infinite sequence of ids")
+    {
+        std::vector<int> vec;
+        for (int id : ids(1000) | std::views::take(5))
+            vec.push_back(id);
+
+        REQUIRE(vec == std::vector{1001, 1002, 1003, 1004, 1005});
+    }
+
+    SECTION("finite generator")
+    {
+        auto evens = [](int n) -> generator<int> {
+            for (int i = 0; i < n; i += 2)
+                co_yield i;
+        };
+
+        auto squares = evens(10) | std::views::transform([](int n) { return n * n; });
+        std::vector<int> vec;
+        std::ranges::copy(squares, std::back_inserter(vec));
+
+        REQUIRE(vec == std::vector{0, 4, 16, 36, 64});
+    }
+
+    SECTION("exception is thrown from the iterator")
+    {
+        auto failing = []() -> generator<int> {
+            co_yield 1;
+            throw std::runtime_error("ERROR");
+        };
+
+        auto gen = failing();
+        auto it = gen.begin();
+        REQUIRE(*it == 1);
+        REQUIRE_THROWS_AS(++it, std::runtime_error);
+    }
+}
+
+TEST_CASE("id generators - ids/s", "[.][benchmark]")
+{
+    constexpr size_t ids_per_thread = 4'000'000;
+    constexpr size_t buffer_size = 64 * 1024;
+
+    std::vector<int> ids(ids_per_thread);
+
+    BENCHMARK("single thread - generate_n + mutable lambda")
+    {
+        std::generate_n(ids.begin(), ids.size(), [seed = 0]() mutable { return ++seed; });
+        return ids.back();
+    };
+
+    BENCHMARK("single thread - IdGenerator::fill")
+    {
+        IdGenerator<int>{0}.fill(ids);
+        return ids.back();
+    };
+
+    REQUIRE(ids.back() == static_cast<int>(ids_per_thread));
+
+    // every thread generates ids_per_thread ids in chunks of buffer_size
+    auto run_threads = [](Catch::Benchmark::Chronometer meter, int no_of_threads, auto thread_body) {
+        meter.measure([&] {
+            std::vector<std::thread> threads;
+            for (int t = 0; t < no_of_threads; ++t)
+                threads.emplace_back(thread_body);
+            for (auto& thd : threads)
+                thd.join();
+        });
+    };
+
+    for (int no_of_threads : {1, 2, 4, 8, 16})
+    {
+        const std::string title = " - threads: " + std::to_string(no_of_threads);
+
+        BENCHMARK_ADVANCED("shared atomic counter" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            std::atomic<uint64_t> shared_counter{0};
+            run_threads(meter, no_of_threads, [&] {
+                std::vector<uint64_t> buffer(buffer_size);
+                for (size_t i = 0; i < ids_per_thread; i += buffer_size)
+                    std::generate(buffer.begin(), buffer.end(), [&] { return ++shared_counter; });
+            });
+        };
+
+        BENCHMARK_ADVANCED("ConcurrentIdGenerator - per call" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            ConcurrentIdGenerator<uint64_t> source{0};
+            run_threads(meter, no_of_threads, [&] {
+                auto gen = source.local();
+                std::vector<uint64_t> buffer(buffer_size);
+                for (size_t i = 0; i < ids_per_thread; i += buffer_size)
+                    std::generate(buffer.begin(), buffer.end(), std::ref(gen));
+            });
+        };
+
+        BENCHMARK_ADVANCED("ConcurrentIdGenerator - fill" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            ConcurrentIdGenerator<uint64_t> source{0};
+            run_threads(meter, no_of_threads, [&] {
+                auto gen = source.local();
+                std::vector<uint64_t> buffer(buffer_size);
+                for (size_t i = 0; i < ids_per_thread; i += buffer_size)
+                    gen.fill(buffer);
+            });
+        };
+    }
+}
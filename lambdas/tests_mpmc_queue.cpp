@@ -0,0 +1,209 @@
+#include "mpmc_queue.hpp"
+#include "task_queue.hpp"
+
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Concurrency;
+
+namespace
+{
+    // reference implementation for benchmarks
+    template <typename T>
+    class MutexQueue
+    {
+        std::queue<T> items_;
+        const size_t capacity_;
+        std::mutex mtx_;
+        std::condition_variable cv_not_empty_;
+        std::condition_variable cv_not_full_;
+
+    public:
+        explicit MutexQueue(size_t capacity)
+            : capacity_{capacity}
+        {
+        }
+
+        void push(T item)
+        {
+            {
+                std::unique_lock lk{mtx_};
+                cv_not_full_.wait(lk, [this] { return items_.size() < capacity_; });
+                items_.push(std::move(item));
+            }
+            cv_not_empty_.notify_one();
+        }
+
+        T pop()
+        {
+            std::unique_lock lk{mtx_};
+            cv_not_empty_.wait(lk, [this] { return !items_.empty(); });
+            T item = std::move(items_.front());
+            items_.pop();
+            lk.unlock();
+
+            cv_not_full_.notify_one();
+            return item;
+        }
+    };
+
+    template <typename TQueue>
+    long long run_producers_consumers(TQueue& queue, int no_of_producers, int no_of_consumers, int items_per_producer)
+    {
+        std::atomic<long long> sum{0};
+        const int total = no_of_producers * items_per_producer;
+        const int items_per_consumer = total / no_of_consumers;
+
+        std::vector<std::thread> threads;
+
+        for (int p = 0; p < no_of_producers; ++p)
+        {
+            threads.emplace_back([&queue, p, items_per_producer] {
+                for (int i = 0; i < items_per_producer; ++i)
+                    queue.push(p * items_per_producer + i);
+            });
+        }
+
+        for (int c = 0; c < no_of_consumers; ++c)
+        {
+            const int count = (c == no_of_consumers - 1) ? total - items_per_consumer * c : items_per_consumer;
+
+            threads.emplace_back([&queue, &sum, count] {
+                long long local_sum = 0;
+                for (int i = 0; i < count; ++i)
+                    local_sum += queue.pop();
+                sum += local_sum;
+            });
+        }
+
+        for (auto& thd : threads)
+            thd.join();
+
+        return sum;
+    }
+}
+
+TEST_CASE("BoundedMpmcQueue")
+{
+    BoundedMpmcQueue<std::string> queue{4};
+
+    REQUIRE(queue.capacity() == 4);
+    REQUIRE_FALSE(queue.try_pop().has_value());
+
+    for (int i = 0; i < 4; ++i)
+        REQUIRE(queue.try_push(std::to_string(i)));
+
+    SECTION("try_push fails when full")
+    {
+        REQUIRE_FALSE(queue.try_push("overflow"));
+    }
+
+    SECTION("try_pop in FIFO order")
+    {
+        REQUIRE(queue.try_pop() == "0");
+        REQUIRE(queue.try_pop() == "1");
+        REQUIRE(queue.try_push("4"));
+        REQUIRE(queue.pop() == "2");
+        REQUIRE(queue.pop() == "3");
+        REQUIRE(queue.pop() == "4");
+    }
+
+    SECTION("capacity must be a power of 2")
+    {
+        REQUIRE_THROWS_AS(BoundedMpmcQueue<int>{10}, std::invalid_argument);
+    }
+}
+
+TEMPLATE_TEST_CASE("BoundedMpmcQueue - many producers & consumers", "[stress]",
+    (BoundedMpmcQueue<int, WaitStrategy::futex>), (BoundedMpmcQueue<int, WaitStrategy::spin>))
+{
+    TestType queue{64};
+
+    constexpr int no_of_producers = 4;
+    constexpr int items_per_producer = 20'000;
+
+    const long long n = no_of_producers * items_per_producer;
+    REQUIRE(run_producers_consumers(queue, no_of_producers, 3, items_per_producer) == n * (n - 1) / 2);
+}
+
+TEST_CASE("TaskQueue - tasks submitted from many threads")
+{
+    BoundedMpmcQueue<TaskQueue::Task> submissions{256};
+    TaskQueue q;
+
+    constexpr int no_of_producers = 4;
+    constexpr int tasks_per_producer = 1'000;
+
+    int counter = 0; // modified only by the consumer thread
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < no_of_producers; ++p)
+    {
+        producers.emplace_back([&] {
+            for (int i = 0; i < tasks_per_producer; ++i)
+            {
+                auto value = std::make_unique<int>(1);
+                submissions.push([&counter, value = std::move(value)] { counter += *value; });
+            }
+        });
+    }
+
+    std::thread consumer{[&] {
+        for (int i = 0; i < no_of_producers * tasks_per_producer; ++i)
+        {
+            q.submit(submissions.pop());
+            q.run(16);
+        }
+        q.run();
+    }};
+
+    for (auto& thd : producers)
+        thd.join();
+    consumer.join();
+
+    REQUIRE(counter == no_of_producers * tasks_per_producer);
+}
+
+TEST_CASE("BoundedMpmcQueue vs mutex + condition_variable", "[.][benchmark]")
+{
+    constexpr int total_items = 1'000'000;
+
+    for (int no_of_threads : {1, 2, 4, 8, 16, 32})
+    {
+        const int items_per_producer = total_items / no_of_threads;
+        const std::string title = " - producers/consumers: " + std::to_string(no_of_threads);
+
+        // queues are empty after every run - one queue is reused by all runs of a benchmark
+        auto benchmark_queue = [&](Catch::Benchmark::Chronometer meter, auto& queue) {
+            meter.measure([&] { return run_producers_consumers(queue, no_of_threads, no_of_threads, items_per_producer); });
+        };
+
+        BENCHMARK_ADVANCED("BoundedMpmcQueue<futex>" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            BoundedMpmcQueue<int, WaitStrategy::futex> queue{1024};
+            benchmark_queue(meter, queue);
+        };
+
+        BENCHMARK_ADVANCED("BoundedMpmcQueue<spin>" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            BoundedMpmcQueue<int, WaitStrategy::spin> queue{1024};
+            benchmark_queue(meter, queue);
+        };
+
+        BENCHMARK_ADVANCED("MutexQueue" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            MutexQueue<int> queue{1024};
+            benchmark_queue(meter, queue);
+        };
+    }
+}
@@ -0,0 +1,174 @@
+#include "priority_task_queue.hpp"
+#include "task_queue.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("PriorityTaskQueue")
+{
+    PriorityTaskQueue q;
+    std::vector<std::string> log;
+
+    auto logger = [&log](std::string text) { return [&log, text] { log.push_back(text); }; };
+
+    SECTION("higher priority classes go first")
+    {
+        q.submit(logger("low"), Priority::low);
+        q.submit(logger("normal"), Priority::normal);
+        q.submit(logger("turn_on_fan"), Priority::high);
+
+        REQUIRE(q.run() == 3);
+        REQUIRE(log == std::vector<std::string>{"turn_on_fan", "normal", "low"});
+    }
+
+    SECTION("earliest deadline first within a class")
+    {
+        const auto now = PriorityTaskQueue::Clock::now();
+
+        q.submit(logger("+30ms"), Priority::normal, now + 30ms);
+        q.submit(logger("+10ms"), Priority::normal, now + 10ms);
+        q.submit(logger("no deadline"), Priority::normal);
+        q.submit(logger("+20ms"), Priority::normal, now + 20ms);
+
+        q.run();
+        REQUIRE(log == std::vector<std::string>{"+10ms", "+20ms", "+30ms", "no deadline"});
+    }
+
+    SECTION("FIFO for equal deadlines")
+    {
+        for (int i = 0; i < 5; ++i)
+            q.submit(logger(std::to_string(i)), Priority::low);
+
+        q.run();
+        REQUIRE(log == std::vector<std::string>{"0", "1", "2", "3", "4"});
+    }
+
+    SECTION("run(max_batch)")
+    {
+        for (int i = 0; i < 5; ++i)
+            q.submit(logger(std::to_string(i)));
+
+        REQUIRE(q.run(2) == 2);
+        REQUIRE(q.ready_count() == 3);
+    }
+}
+
+TEST_CASE("PriorityTaskQueue - starvation protection")
+{
+    PriorityTaskQueue q{PriorityTaskQueue::Options{.starvation_limit = 2}};
+
+    std::vector<std::string> log;
+    int high_tasks_left = 10;
+
+    // high priority task that keeps resubmitting itself
+    std::function<void()> busy_high = [&] {
+        log.push_back("high");
+        if (--high_tasks_left > 0)
+            q.submit([&] { busy_high(); }, Priority::high);
+    };
+
+    q.submit([&] { busy_high(); }, Priority::high);
+    q.submit([&] { log.push_back("low"); }, Priority::low);
+
+    q.run();
+
+    auto low_pos = std::find(log.begin(), log.end(), "low");
+    REQUIRE(low_pos != log.end());
+    REQUIRE(low_pos - log.begin() == 2); // skipped twice, then runs before the 3rd high task
+}
+
+TEST_CASE("PriorityTaskQueue - delayed tasks")
+{
+    PriorityTaskQueue q{PriorityTaskQueue::Options{.timer_tick = 1ms, .timer_wheel_size = 8}};
+    std::vector<std::string> log;
+
+    q.submit_after(20ms, [&] { log.push_back("delayed"); }, Priority::high);
+    q.submit([&] { log.push_back("now"); }, Priority::low);
+
+    REQUIRE(q.delayed_count() == 1);
+
+    q.run();
+    REQUIRE(log == std::vector<std::string>{"now"});
+
+    SECTION("task becomes ready when due - delay longer than the wheel revolution")
+    {
+        std::this_thread::sleep_for(25ms);
+
+        q.run();
+        REQUIRE(log == std::vector<std::string>{"now", "delayed"});
+        REQUIRE(q.empty());
+    }
+}
+
+TEST_CASE("PriorityTaskQueue - latency of high priority tasks", "[.][benchmark]")
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int no_of_low_tasks = 100'000;
+    constexpr int backlog = 1'000;
+    constexpr int high_task_every = 50;
+
+    auto busy_work = [] {
+        auto start = Clock::now();
+        while (Clock::now() - start < 1us)
+            ;
+    };
+
+    auto report = [](const char* title, std::vector<Clock::duration>& latencies) {
+        std::sort(latencies.begin(), latencies.end());
+        auto p = [&](double q) { return std::chrono::duration_cast<std::chrono::microseconds>(latencies[static_cast<size_t>(q * (latencies.size() - 1))]).count(); };
+
+        std::cout << title << " - high priority latency p50: " << p(0.5) << "us, p99: " << p(0.99) << "us\n";
+    };
+
+    SECTION("FIFO TaskQueue")
+    {
+        TaskQueue q;
+        std::vector<Clock::duration> latencies;
+        int low_tasks_left = no_of_low_tasks;
+
+        std::function<void()> low_task = [&] {
+            busy_work();
+            if (--low_tasks_left > 0)
+                q.submit([&] { low_task(); }); // keeps the queue saturated
+
+            if (low_tasks_left % high_task_every == 0)
+                q.submit([&latencies, submitted = Clock::now()] { latencies.push_back(Clock::now() - submitted); });
+        };
+
+        for (int i = 0; i < backlog; ++i)
+            q.submit([&] { low_task(); });
+        q.run();
+
+        report("TaskQueue (FIFO)", latencies);
+    }
+
+    SECTION("PriorityTaskQueue")
+    {
+        PriorityTaskQueue q;
+        std::vector<Clock::duration> latencies;
+        int low_tasks_left = no_of_low_tasks;
+
+        std::function<void()> low_task = [&] {
+            busy_work();
+            if (--low_tasks_left > 0)
+                q.submit([&] { low_task(); }, Priority::low);
+
+            if (low_tasks_left % high_task_every == 0)
+                q.submit([&latencies, submitted = Clock::now()] { latencies.push_back(Clock::now() - submitted); }, Priority::high);
+        };
+
+        for (int i = 0; i < backlog; ++i)
+            q.submit([&] { low_task(); }, Priority::low);
+        q.run();
+
+        report("PriorityTaskQueue", latencies);
+    }
+}
@@ -0,0 +1,225 @@
+#include "radix_sort.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    std::vector<T> random_values(size_t size, unsigned seed)
+    {
+        std::mt19937_64 rnd{seed};
+        std::vector<T> values(size);
+
+        for (auto& value : values)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+                value = static_cast<T>(std::uniform_real_distribution<double>{-1e6, 1e6}(rnd));
+            else
+                value = static_cast<T>(rnd()); // whole range - including negative & above the signed maximum
+        }
+
+        return values;
+    }
+}
+
+TEMPLATE_TEST_CASE("Sorting::radix_sort", "[radix_sort]",
+    int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double)
+{
+    for (size_t size : {0, 1, 100, 5'000})
+        for (unsigned digit_bits : {Sorting::auto_digit_bits, 8u, 11u, 16u})
+        {
+            INFO("size: " << size << ", digit bits: " << digit_bits);
+
+            auto values = random_values<TestType>(size, static_cast<unsigned>(size + digit_bits));
+            auto expected = values;
+            std::sort(expected.begin(), expected.end());
+
+            Sorting::radix_sort(values, digit_bits);
+
+            REQUIRE(values == expected);
+        }
+}
+
+TEST_CASE("Sorting::radix_sort - edge cases")
+{
+    SECTION("passes with one digit value are skipped - small range & equal keys")
+    {
+        auto values = random_values<uint32_t>(10'000, 1);
+        for (auto& value : values)
+            value %= 256;
+
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+        Sorting::radix_sort(values);
+        REQUIRE(values == expected);
+
+        std::vector<int64_t> same(1'000, -42);
+        Sorting::radix_sort(same);
+        REQUIRE(same == std::vector<int64_t>(1'000, -42));
+    }
+
+    SECTION("floats - negative zero before zero, NaNs at the ends")
+    {
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        std::vector<float> values(300, 1.0f);
+        values[0] = 0.0f;
+        values[1] = -0.0f;
+        values[2] = nan;
+        values[3] = -nan;
+        values[4] = -std::numeric_limits<float>::infinity();
+
+        Sorting::radix_sort(values, 8);
+
+        REQUIRE((std::isnan(values[0]) && std::signbit(values[0])));
+        REQUIRE(values[1] == -std::numeric_limits<float>::infinity());
+        REQUIRE((values[2] == 0.0f && std::signbit(values[2])));
+        REQUIRE((values[3] == 0.0f && !std::signbit(values[3])));
+        REQUIRE(std::isnan(values.back()));
+    }
+
+    SECTION("unsupported digit width")
+    {
+        std::vector<int> values(1'000);
+        REQUIRE_THROWS_AS(Sorting::radix_sort(values, 12), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Sorting::radix_sort_by_key & argsort")
+{
+    std::vector<int> keys = {5, -1, 3, 5, -1, 0, 3};
+
+    SECTION("values follow keys - stable for equal keys")
+    {
+        std::vector<std::string> values = {"a", "b", "c", "d", "e", "f", "g"};
+
+        Sorting::radix_sort_by_key(keys, values);
+
+        REQUIRE(keys == std::vector{-1, -1, 0, 3, 3, 5, 5});
+        REQUIRE(values == std::vector<std::string>{"b", "e", "f", "c", "g", "a", "d"});
+    }
+
+    SECTION("argsort")
+    {
+        REQUIRE(Sorting::argsort(keys) == std::vector<size_t>{1, 4, 5, 2, 6, 0, 3});
+        REQUIRE(keys == std::vector{5, -1, 3, 5, -1, 0, 3});
+    }
+
+    SECTION("argsort of many floats")
+    {
+        const auto values = random_values<double>(10'000, 665);
+
+        std::vector<size_t> expected(values.size());
+        std::iota(expected.begin(), expected.end(), size_t{0});
+        std::stable_sort(expected.begin(), expected.end(), [&](size_t a, size_t b) { return values[a] < values[b]; });
+
+        REQUIRE(Sorting::argsort(values) == expected);
+    }
+
+    SECTION("sizes of keys & values differ")
+    {
+        std::vector<int> values(3);
+        REQUIRE_THROWS_AS(Sorting::radix_sort_by_key(keys, values), std::invalid_argument);
+    }
+}
+
+TEMPLATE_TEST_CASE("Sorting::parallel_radix_sort", "[radix_sort]", int32_t, uint64_t, float)
+{
+    Concurrency::ThreadPool pool{4};
+
+    for (size_t size : {10, 1'000, 100'003})
+    {
+        INFO("size: " << size);
+
+        auto values = random_values<TestType>(size, static_cast<unsigned>(size));
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        Sorting::parallel_radix_sort(pool, values, Sorting::auto_digit_bits, 1'000);
+
+        REQUIRE(values == expected);
+    }
+}
+
+namespace
+{
+    template <typename T>
+    void benchmark_sorts(Concurrency::ThreadPool& pool, const std::string& distribution, const std::vector<T>& data)
+    {
+        const std::string title = " - " + distribution + ", size: " + std::to_string(data.size());
+
+        // every run sorts its own copy of data
+        auto benchmark_sort = [&data](Catch::Benchmark::Chronometer meter, auto sort) {
+            std::vector<std::vector<T>> copies(meter.runs(), data);
+            meter.measure([&](int run) { sort(copies[run]); });
+            REQUIRE(std::is_sorted(copies.front().begin(), copies.front().end()));
+        };
+
+        BENCHMARK_ADVANCED("std::sort" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            benchmark_sort(meter, [](auto& values) { std::sort(values.begin(), values.end()); });
+        };
+
+        BENCHMARK_ADVANCED("std::sort + lambda" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            benchmark_sort(meter, [](auto& values) { std::sort(values.begin(), values.end(), [](T a, T b) { return a < b; }); });
+        };
+
+        BENCHMARK_ADVANCED("Sorting::radix_sort" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            benchmark_sort(meter, [](auto& values) { Sorting::radix_sort(values); });
+        };
+
+        BENCHMARK_ADVANCED("Sorting::parallel_radix_sort" + title)(Catch::Benchmark::Chronometer meter)
+        {
+            benchmark_sort(meter, [&pool](auto& values) { Sorting::parallel_radix_sort(pool, values); });
+        };
+    }
+}
+
+TEST_CASE("radix sort vs std::sort", "[.][benchmark]")
+{
+    Concurrency::ThreadPool pool;
+
+    // 10^9 keys (4 GB + 4 GB of buffer) do not fit in memory of a typical CI runner - 10^8 is the largest case
+    for (size_t size : {100'000, 1'000'000, 10'000'000, 100'000'000})
+    {
+        std::mt19937_64 rnd{665};
+
+        std::vector<int32_t> uniform_ints(size);
+        std::ranges::generate(uniform_ints, [&] { return static_cast<int32_t>(rnd()); });
+        benchmark_sorts(pool, "int32 uniform", uniform_ints);
+
+        std::vector<float> normal_floats(size);
+        std::normal_distribution<float> normal{0.0f, 100.0f};
+        std::ranges::generate(normal_floats, [&] { return normal(rnd); });
+        benchmark_sorts(pool, "float normal", normal_floats);
+
+        if (size > 10'000'000)
+            continue;
+
+        std::vector<int32_t> small_range(size);
+        std::ranges::generate(small_range, [&] { return static_cast<int32_t>(rnd() % 1000); });
+        benchmark_sorts(pool, "int32 0..999", small_range);
+
+        std::vector<uint64_t> uniform_uint64s(size);
+        std::ranges::generate(uniform_uint64s, [&] { return rnd(); });
+        benchmark_sorts(pool, "uint64 uniform", uniform_uint64s);
+
+        std::vector<double> exponential_doubles(size);
+        std::exponential_distribution<double> exponential{1.0};
+        std::ranges::generate(exponential_doubles, [&] { return exponential(rnd); });
+        benchmark_sorts(pool, "double exponential", exponential_doubles);
+    }
+}
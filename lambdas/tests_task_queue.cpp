@@ -0,0 +1,237 @@
+#include "task_queue.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <queue>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // counts copies of captured state - each copy of a shared_ptr is an atomic increment (and decrement later)
+    struct CopyCounter
+    {
+        inline static size_t copies = 0;
+
+        CopyCounter() = default;
+
+        CopyCounter(const CopyCounter&)
+        {
+            ++copies;
+        }
+
+        CopyCounter(CopyCounter&&) noexcept = default;
+    };
+
+    // TaskQueue before the rework - copies every task out of the queue
+    struct LegacyTaskQueue
+    {
+        using Task = std::function<void()>;
+
+        std::queue<Task> tasks_;
+
+        template <typename TTask>
+        void submit(TTask&& task)
+        {
+            tasks_.push(std::forward<TTask>(task));
+        }
+
+        void run()
+        {
+            while (!tasks_.empty())
+            {
+                Task task = tasks_.front();
+                task();
+                tasks_.pop();
+            }
+        }
+    };
+}
+
+TEST_CASE("TaskQueue - ring buffer")
+{
+    TaskQueue q{4};
+    std::vector<int> log;
+
+    SECTION("tasks are executed in FIFO order")
+    {
+        for (int i = 0; i < 10; ++i) // grows
+            q.submit([&log, i] { log.push_back(i); });
+
+        REQUIRE(q.size() == 10);
+        REQUIRE(q.run() == 10);
+        REQUIRE(log == std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        REQUIRE(q.empty());
+    }
+
+    SECTION("tasks returning values are accepted - results are discarded")
+    {
+        q.submit([&log] { log.push_back(1); return log.size(); });
+
+        REQUIRE(q.run() == 1);
+        REQUIRE(log == std::vector{1});
+    }
+
+    SECTION("run(max_batch) executes at most max_batch tasks")
+    {
+        for (int i = 0; i < 5; ++i)
+            q.submit([&log, i] { log.push_back(i); });
+
+        REQUIRE(q.run(2) == 2);
+        REQUIRE(log == std::vector{0, 1});
+        REQUIRE(q.size() == 3);
+
+        REQUIRE(q.run(10) == 3);
+        REQUIRE(log == std::vector{0, 1, 2, 3, 4});
+    }
+
+    SECTION("submit_bulk")
+    {
+        std::vector<std::function<void()>> tasks;
+        for (int i = 0; i < 3; ++i)
+            tasks.push_back([&log, i] { log.push_back(i); });
+
+        q.submit_bulk(tasks);
+        q.submit_bulk(std::ranges::subrange{std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end())});
+        q.run();
+
+        REQUIRE(log == std::vector{0, 1, 2, 0, 1, 2});
+        REQUIRE(std::ranges::none_of(tasks, [](const auto& task) { return static_cast<bool>(task); }));
+    }
+
+    SECTION("submit_bulk of a view copies tasks - the container keeps them")
+    {
+        std::vector<std::function<void()>> tasks;
+        for (int i = 0; i < 3; ++i)
+            tasks.push_back([&log, i] { log.push_back(i); });
+
+        q.submit_bulk(tasks | std::views::take(2));
+        q.run();
+
+        REQUIRE(log == std::vector{0, 1});
+        REQUIRE(std::ranges::all_of(tasks, [](const auto& task) { return static_cast<bool>(task); }));
+    }
+
+    SECTION("running tasks may submit new tasks")
+    {
+        std::function<void(int)> spawn = [&](int depth) {
+            log.push_back(depth);
+            if (depth < 20)
+            {
+                q.submit([&spawn, depth] { spawn(depth + 1); });
+                q.submit([&log] { log.push_back(-1); });
+            }
+        };
+
+        q.submit([&spawn] { spawn(0); });
+        q.run();
+
+        REQUIRE(log.size() == 41);
+        REQUIRE(q.empty());
+    }
+
+    SECTION("running task stays valid when buffer grows")
+    {
+        auto text = std::make_unique<std::string>("captured");
+        std::string result;
+
+        q.submit([&q, &result, text = std::move(text)] {
+            for (int i = 0; i < 100; ++i)
+                q.submit([] {});
+
+            result = *text; // captured state is still alive
+        });
+
+        q.run();
+
+        REQUIRE(result == "captured");
+        REQUIRE(q.capacity() >= 128);
+    }
+
+    SECTION("task throwing an exception is destroyed - remaining tasks are kept")
+    {
+        auto resource = std::make_shared<int>(42);
+
+        q.submit([resource] { throw std::runtime_error("ERROR"); });
+        q.submit([&log] { log.push_back(1); });
+
+        REQUIRE_THROWS_AS(q.run(), std::runtime_error);
+        REQUIRE(resource.use_count() == 1);
+        REQUIRE(q.size() == 1);
+
+        q.run();
+        REQUIRE(log == std::vector{1});
+    }
+
+    SECTION("tasks are executed in place - captured state is not copied")
+    {
+        CopyCounter counter;
+        q.submit([counter] {});
+
+        CopyCounter::copies = 0;
+        q.run();
+
+        REQUIRE(CopyCounter::copies == 0);
+    }
+}
+
+TEST_CASE("TaskQueue - before & after", "[.][benchmark]")
+{
+    constexpr int no_of_tasks = 10'000;
+
+    auto fan = std::make_shared<int>(0);
+
+    CopyCounter counter;
+
+    CopyCounter::copies = 0;
+    {
+        LegacyTaskQueue q;
+        for (int i = 0; i < no_of_tasks; ++i)
+            q.submit([counter] {});
+        q.run();
+    }
+    std::cout << "LegacyTaskQueue - captured state copies per task (1 = capture into the lambda): " << static_cast<double>(CopyCounter::copies) / no_of_tasks << "\n";
+
+    CopyCounter::copies = 0;
+    {
+        TaskQueue q;
+        for (int i = 0; i < no_of_tasks; ++i)
+            q.submit([counter] {});
+        q.run();
+    }
+    std::cout << "TaskQueue - captured state copies per task (1 = capture into the lambda): " << static_cast<double>(CopyCounter::copies) / no_of_tasks << "\n";
+
+    BENCHMARK("LegacyTaskQueue [fan]")
+    {
+        LegacyTaskQueue q;
+        for (int i = 0; i < no_of_tasks; ++i)
+            q.submit([fan] { ++*fan; });
+        q.run();
+    };
+
+    BENCHMARK("TaskQueue [fan]")
+    {
+        TaskQueue q;
+        for (int i = 0; i < no_of_tasks; ++i)
+            q.submit([fan] { ++*fan; });
+        q.run();
+    };
+
+    TaskQueue reused_queue{no_of_tasks};
+
+    BENCHMARK("TaskQueue [fan] - run(256) batches, reused buffer")
+    {
+        for (int i = 0; i < no_of_tasks; ++i)
+            reused_queue.submit([fan] { ++*fan; });
+
+        while (reused_queue.run(256) > 0)
+            ;
+    };
+}
@@ -0,0 +1,135 @@
+#include "task_tracer.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("TracedTaskQueue")
+{
+    TaskTracer tracer;
+    TracedTaskQueue q{tracer, 4};
+
+    SECTION("every executed task is recorded")
+    {
+        for (int i = 0; i < 10; ++i) // grows - enqueue times are moved with tasks
+            q.submit([] { std::this_thread::sleep_for(100us); });
+
+        q.run();
+
+        auto events = tracer.events();
+        REQUIRE(events.size() == 10);
+
+        for (size_t i = 0; i < events.size(); ++i)
+        {
+            REQUIRE(events[i].enqueued <= events[i].started);
+            REQUIRE(events[i].finished - events[i].started >= 100us);
+            REQUIRE(events[i].queue_depth == 10 - i);
+        }
+    }
+
+    SECTION("time spent in the queue")
+    {
+        q.submit([] { std::this_thread::sleep_for(5ms); });
+        q.submit([] {});
+
+        q.run();
+
+        auto events = tracer.events();
+        REQUIRE(events.size() == 2);
+        REQUIRE(events[1].started - events[1].enqueued >= 5ms);
+    }
+
+    SECTION("export as Chrome trace-event JSON")
+    {
+        q.submit([] {});
+        q.run();
+
+        std::stringstream out;
+        tracer.write_chrome_trace(out);
+
+        const std::string json = out.str();
+        REQUIRE(json.starts_with(R"({"traceEvents":[)"));
+        REQUIRE(json.find(R"("ph":"X")") != std::string::npos);
+        REQUIRE(json.find(R"("queue_depth":1)") != std::string::npos);
+        REQUIRE(json.ends_with("]}\n"));
+    }
+}
+
+TEST_CASE("TaskTracer - per thread buffers")
+{
+    TaskTracer tracer{100};
+
+    constexpr int no_of_threads = 4;
+    constexpr int tasks_per_thread = 150;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < no_of_threads; ++t)
+    {
+        workers.emplace_back([&tracer] {
+            TracedTaskQueue q{tracer};
+            for (int i = 0; i < tasks_per_thread; ++i)
+                q.submit([] {});
+            q.run();
+        });
+    }
+
+    for (auto& thd : workers)
+        thd.join();
+
+    auto events = tracer.events();
+    REQUIRE(events.size() == no_of_threads * 100);
+    REQUIRE(tracer.dropped_count() == no_of_threads * 50);
+
+    std::set<uint32_t> thread_indexes;
+    for (const auto& e : events)
+        thread_indexes.insert(e.thread_index);
+    REQUIRE(thread_indexes.size() == no_of_threads);
+}
+
+TEST_CASE("TaskQueue - tracing overhead", "[.][benchmark]")
+{
+    constexpr int no_of_tasks = 10'000;
+
+    auto fan = std::make_shared<int>(0);
+
+    TaskQueue untraced_queue{no_of_tasks};
+
+    BENCHMARK("TaskQueue - tracing disabled")
+    {
+        for (int i = 0; i < no_of_tasks; ++i)
+            untraced_queue.submit([fan] { ++*fan; });
+        return untraced_queue.run();
+    };
+
+    std::vector<TaskQueue::Task> tasks;
+    tasks.reserve(no_of_tasks);
+
+    BENCHMARK("no queue - vector<Task> (lower bound)")
+    {
+        for (int i = 0; i < no_of_tasks; ++i)
+            tasks.push_back([fan] { ++*fan; });
+        for (auto& task : tasks)
+            task();
+        tasks.clear();
+    };
+
+    BENCHMARK_ADVANCED("TracedTaskQueue")(Catch::Benchmark::Chronometer meter)
+    {
+        TaskTracer tracer{static_cast<size_t>(meter.runs()) * no_of_tasks};
+        TracedTaskQueue traced_queue{tracer, no_of_tasks};
+
+        meter.measure([&] {
+            for (int i = 0; i < no_of_tasks; ++i)
+                traced_queue.submit([fan] { ++*fan; });
+            return traced_queue.run();
+        });
+    };
+}
@@ -0,0 +1,222 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Concurrency;
+
+TEST_CASE("WorkStealingDeque")
+{
+    WorkStealingDeque<int> deque{2};
+
+    for (int i = 1; i <= 5; ++i)
+        deque.push(i); // grows
+
+    SECTION("owner pops in LIFO order")
+    {
+        REQUIRE(deque.pop() == 5);
+        REQUIRE(deque.pop() == 4);
+    }
+
+    SECTION("thief steals in FIFO order")
+    {
+        REQUIRE(deque.steal() == 1);
+        REQUIRE(deque.steal() == 2);
+    }
+
+    SECTION("empty deque")
+    {
+        while (deque.pop())
+            ;
+
+        REQUIRE(deque.empty());
+        REQUIRE_FALSE(deque.pop().has_value());
+        REQUIRE_FALSE(deque.steal().has_value());
+    }
+}
+
+TEST_CASE("WorkStealingDeque - concurrent steals")
+{
+    constexpr int no_of_items = 100'000;
+    constexpr int no_of_thieves = 3;
+
+    WorkStealingDeque<int> deque{64};
+    std::vector<std::atomic<int>> taken(no_of_items);
+    std::atomic<bool> is_done{false};
+
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < no_of_thieves; ++i)
+    {
+        thieves.emplace_back([&] {
+            while (!is_done)
+            {
+                if (auto item = deque.steal())
+                    ++taken[*item];
+            }
+        });
+    }
+
+    for (int i = 0; i < no_of_items; ++i)
+    {
+        deque.push(i);
+
+        if (i % 3 == 0)
+        {
+            if (auto item = deque.pop())
+                ++taken[*item];
+        }
+    }
+
+    while (auto item = deque.pop())
+        ++taken[*item];
+
+    is_done = true;
+    for (auto& thd : thieves)
+        thd.join();
+
+    REQUIRE(std::all_of(taken.begin(), taken.end(), [](const auto& counter) { return counter == 1; }));
+}
+
+TEST_CASE("ThreadPool")
+{
+    ThreadPool pool{4};
+
+    SECTION("submit returns future")
+    {
+        auto f1 = pool.submit([] { return 42; });
+        auto f2 = pool.submit([] { return std::string{"text"}; });
+
+        REQUIRE(f1.get() == 42);
+        REQUIRE(f2.get() == "text");
+    }
+
+    SECTION("exception is passed through future")
+    {
+        auto f = pool.submit([]() -> int { throw std::runtime_error("ERROR"); });
+
+        REQUIRE_THROWS_AS(f.get(), std::runtime_error);
+    }
+
+    SECTION("tasks submitted from many threads")
+    {
+        std::atomic<int> counter{0};
+
+        std::vector<std::thread> producers;
+        for (int i = 0; i < 4; ++i)
+        {
+            producers.emplace_back([&] {
+                for (int j = 0; j < 1'000; ++j)
+                    pool.post([&counter] { ++counter; });
+            });
+        }
+
+        for (auto& thd : producers)
+            thd.join();
+
+        pool.shutdown();
+
+        REQUIRE(counter == 4'000);
+    }
+}
+
+namespace
+{
+    long long parallel_sum(ThreadPool& pool, const int* first, const int* last)
+    {
+        if (last - first <= 1'000)
+            return std::accumulate(first, last, 0LL);
+
+        const int* middle = first + (last - first) / 2;
+
+        auto left = pool.submit([&pool, first, middle] { return parallel_sum(pool, first, middle); });
+        long long right = parallel_sum(pool, middle, last);
+
+        return pool.wait(left) + right;
+    }
+}
+
+TEST_CASE("ThreadPool - fork/join")
+{
+    std::vector<int> data(1'000'000);
+    std::iota(data.begin(), data.end(), 0);
+
+    ThreadPool pool{4};
+
+    auto result = pool.submit([&] { return parallel_sum(pool, data.data(), data.data() + data.size()); });
+
+    REQUIRE(result.get() == 999'999LL * 1'000'000 / 2);
+}
+
+TEST_CASE("ThreadPool - graceful shutdown")
+{
+    std::atomic<int> counter{0};
+
+    {
+        ThreadPool pool{2};
+
+        for (int i = 0; i < 1'000; ++i)
+        {
+            pool.post([&pool, &counter] {
+                pool.post([&counter] { ++counter; }); // nested tasks are drained too
+                ++counter;
+            });
+        }
+    } // drains all tasks
+
+    REQUIRE(counter == 2'000);
+
+    SECTION("submit after shutdown throws")
+    {
+        ThreadPool pool{1};
+        pool.shutdown();
+
+        REQUIRE_THROWS_AS(pool.submit([] { return 1; }), std::runtime_error);
+    }
+}
+
+TEST_CASE("ThreadPool - throughput", "[.][benchmark]")
+{
+    const unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<int> data(10'000'000);
+    std::iota(data.begin(), data.end(), 0);
+
+    for (unsigned no_of_threads = 1; no_of_threads <= max_threads; no_of_threads *= 2)
+    {
+        const std::string threads = " - threads: " + std::to_string(no_of_threads);
+
+        BENCHMARK_ADVANCED("10^6 tiny tasks" + threads)(Catch::Benchmark::Chronometer meter)
+        {
+            constexpr int no_of_tasks = 1'000'000;
+
+            ThreadPool pool{no_of_threads};
+            std::atomic<int> counter{0};
+
+            meter.measure([&] {
+                counter = 0;
+                for (int i = 0; i < no_of_tasks; ++i)
+                    pool.post([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+
+                while (counter.load(std::memory_order_acquire) != no_of_tasks)
+                    std::this_thread::yield();
+            });
+        };
+
+        BENCHMARK_ADVANCED("fork/join sum of 10^7 ints" + threads)(Catch::Benchmark::Chronometer meter)
+        {
+            ThreadPool pool{no_of_threads};
+
+            meter.measure([&] {
+                auto result = pool.submit([&] { return parallel_sum(pool, data.data(), data.data() + data.size()); });
+                return result.get();
+            });
+        };
+    }
+}
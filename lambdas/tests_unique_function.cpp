@@ -0,0 +1,252 @@
+#include "unique_function.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <queue>
+#include <string>
+
+namespace
+{
+    struct Counter
+    {
+        int* destroyed;
+
+        explicit Counter(int* destroyed)
+            : destroyed{destroyed}
+        {
+        }
+
+        Counter(Counter&& other) noexcept
+            : destroyed{std::exchange(other.destroyed, nullptr)}
+        {
+        }
+
+        ~Counter()
+        {
+            if (destroyed)
+                ++*destroyed;
+        }
+
+        int operator()() const
+        {
+            return 42;
+        }
+    };
+
+    struct Fan
+    {
+        bool is_on = false;
+
+        void on()
+        {
+            is_on = true;
+        }
+    };
+
+    // callable that counts its own heap allocations - class-specific operator new is used by new-expressions
+    // of unique_function & std::function (no replacement of the global operator new is needed)
+    template <size_t PayloadSize>
+    struct CountedCallable
+    {
+        inline static size_t allocation_count = 0;
+
+        std::shared_ptr<Fan> fan;
+        std::array<char, PayloadSize> payload{};
+
+        size_t operator()() const
+        {
+            if (fan)
+                fan->on();
+            return payload.size();
+        }
+
+        static void* operator new(size_t size)
+        {
+            ++allocation_count;
+            return ::operator new(size);
+        }
+
+        static void operator delete(void* ptr) noexcept
+        {
+            ::operator delete(ptr);
+        }
+    };
+}
+
+TEST_CASE("unique_function")
+{
+    SECTION("default constructed is empty")
+    {
+        unique_function<void()> f;
+
+        REQUIRE_FALSE(f);
+        REQUIRE_THROWS_AS(f(), std::bad_function_call);
+    }
+
+    SECTION("stores function pointers & lambdas")
+    {
+        unique_function<int(int, int)> f = [](int a, int b) { return a + b; };
+        REQUIRE(f(1, 2) == 3);
+
+        f = unique_function<int(int, int)>{[](int a, int b) { return a * b; }};
+        REQUIRE(f(3, 4) == 12);
+    }
+
+    SECTION("result of a callable is discarded for void return type - like std::function")
+    {
+        int calls = 0;
+        unique_function<void()> f = [&calls] { return ++calls; };
+
+        f();
+        REQUIRE(calls == 1);
+
+        unique_function<void(int)> g = std::function<int(int)>{[](int x) { return x * 2; }};
+        g(21);
+    }
+
+    SECTION("null pointers & empty std::function make an empty unique_function")
+    {
+        int (*null_function)(int, int) = nullptr;
+        unique_function<int(int, int)> f = null_function;
+        REQUIRE_FALSE(f);
+        REQUIRE_THROWS_AS(f(1, 2), std::bad_function_call);
+
+        void (Fan::*null_member)() = nullptr;
+        unique_function<void(Fan&)> g = null_member;
+        REQUIRE_FALSE(g);
+
+        unique_function<void()> h = std::function<void()>{};
+        REQUIRE_FALSE(h);
+
+        unique_function<void(Fan&)> on = &Fan::on;
+        REQUIRE(on);
+        Fan fan;
+        on(fan);
+        REQUIRE(fan.is_on);
+    }
+
+    SECTION("accepts move-only callables")
+    {
+        auto ptr = std::make_unique<std::string>("text");
+        unique_function<std::string()> f = [ptr = std::move(ptr)] { return *ptr; };
+
+        REQUIRE(f() == "text");
+
+        auto other = std::move(f);
+        REQUIRE_FALSE(f);
+        REQUIRE(other() == "text");
+    }
+
+    SECTION("small callables are stored inline")
+    {
+        using Callable = CountedCallable<16>;
+        auto fan = std::make_shared<Fan>();
+
+        const auto allocations_before = Callable::allocation_count;
+        unique_function<size_t()> f = Callable{fan};
+        unique_function<size_t()> moved = std::move(f);
+        moved();
+
+        REQUIRE(Callable::allocation_count == allocations_before);
+        REQUIRE(fan->is_on);
+    }
+
+    SECTION("large callables are stored on the heap")
+    {
+        using Callable = CountedCallable<128>;
+
+        const auto allocations_before = Callable::allocation_count;
+        unique_function<size_t()> f = Callable{};
+        auto moved = std::move(f);
+
+        REQUIRE(Callable::allocation_count == allocations_before + 1);
+        REQUIRE(moved() == 128);
+    }
+
+    SECTION("inline buffer size is configurable")
+    {
+        using Callable = CountedCallable<96>;
+
+        const auto allocations_before = Callable::allocation_count;
+        unique_function<size_t(), 128> f = Callable{};
+
+        REQUIRE(Callable::allocation_count == allocations_before);
+        REQUIRE(f() == 96);
+    }
+
+    SECTION("callable is destroyed exactly once")
+    {
+        int destroyed = 0;
+
+        {
+            unique_function<int()> f = Counter{&destroyed};
+            auto moved = std::move(f);
+            REQUIRE(moved() == 42);
+
+            unique_function<int()> assigned;
+            assigned = std::move(moved);
+        }
+
+        REQUIRE(destroyed == 1);
+    }
+}
+
+TEST_CASE("unique_function vs std::function - submit + run", "[.][benchmark]")
+{
+    constexpr int no_of_tasks = 1'000;
+
+    using Callable = CountedCallable<8>; // shared_ptr + 8 bytes - like a lambda capturing [fan, id]
+    auto fan = std::make_shared<Fan>();
+
+    auto report_allocations = [&](const char* title, auto submit_and_run) {
+        const auto allocations_before = Callable::allocation_count;
+        submit_and_run();
+        std::cout << title << " - allocations of callables per task: "
+                  << static_cast<double>(Callable::allocation_count - allocations_before) / no_of_tasks << "\n";
+    };
+
+    auto std_function_queue = [&] {
+        std::queue<std::function<size_t()>> tasks;
+
+        for (int i = 0; i < no_of_tasks; ++i)
+            tasks.push(Callable{fan});
+
+        while (!tasks.empty())
+        {
+            auto task = std::move(tasks.front());
+            tasks.pop();
+            task();
+        }
+    };
+
+    auto unique_function_queue = [&] {
+        std::queue<unique_function<size_t()>> tasks;
+
+        for (int i = 0; i < no_of_tasks; ++i)
+            tasks.push(Callable{fan});
+
+        while (!tasks.empty())
+        {
+            auto task = std::move(tasks.front());
+            tasks.pop();
+            task();
+        }
+    };
+
+    report_allocations("std::function [fan]", std_function_queue);
+    report_allocations("unique_function [fan]", unique_function_queue);
+
+    BENCHMARK("std::function [fan]")
+    {
+        std_function_queue();
+    };
+
+    BENCHMARK("unique_function [fan]")
+    {
+        unique_function_queue();
+    };
+}
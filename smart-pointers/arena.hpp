@@ -0,0 +1,135 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Memory
+{
+    /////////////////////////////////////////////////////////////////////////////
+    // Arena - monotonic allocator
+    //  - allocation is a pointer bump inside the current chunk
+    //  - objects cannot be released one by one - reset() destroys all of them (in reverse order)
+    //  - chunks are kept after reset() and reused by the next batch of objects
+    class Arena
+    {
+        struct Chunk
+        {
+            std::unique_ptr<std::byte[]> memory;
+            size_t size;
+        };
+
+        struct DestructorNode
+        {
+            void (*destroy)(void*);
+            void* object;
+            DestructorNode* next;
+        };
+
+        size_t chunk_size_;
+        std::vector<Chunk> chunks_;
+        size_t current_chunk_ = 0;
+        std::byte* current_ = nullptr;
+        size_t remaining_ = 0;
+        DestructorNode* destructors_ = nullptr;
+
+    public:
+        explicit Arena(size_t chunk_size = 4096)
+            : chunk_size_{chunk_size}
+        {
+        }
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        ~Arena()
+        {
+            destroy_objects();
+        }
+
+        void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+        {
+            void* ptr = current_;
+            if (!current_ || !std::align(alignment, bytes, ptr, remaining_))
+            {
+                next_chunk(bytes + alignment);
+                ptr = current_;
+                std::align(alignment, bytes, ptr, remaining_);
+            }
+
+            current_ = static_cast<std::byte*>(ptr) + bytes;
+            remaining_ -= bytes;
+
+            return ptr;
+        }
+
+        template <typename T, typename... TArgs>
+        T* create(TArgs&&... args)
+        {
+            void* memory = allocate(sizeof(T), alignof(T));
+            T* object = ::new (memory) T(std::forward<TArgs>(args)...);
+
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                void* node_memory = allocate(sizeof(DestructorNode), alignof(DestructorNode));
+                destructors_ = ::new (node_memory) DestructorNode{[](void* obj) { static_cast<T*>(obj)->~T(); }, object, destructors_};
+            }
+
+            return object;
+        }
+
+        // destroys all objects created in the arena - the memory is kept for reuse
+        void reset()
+        {
+            destroy_objects();
+
+            current_chunk_ = 0;
+            current_ = chunks_.empty() ? nullptr : chunks_.front().memory.get();
+            remaining_ = chunks_.empty() ? 0 : chunks_.front().size;
+        }
+
+        size_t capacity() const
+        {
+            size_t total = 0;
+            for (const auto& chunk : chunks_)
+                total += chunk.size;
+            return total;
+        }
+
+    private:
+        void destroy_objects()
+        {
+            for (DestructorNode* node = destructors_; node != nullptr; node = node->next)
+                node->destroy(node->object);
+
+            destructors_ = nullptr;
+        }
+
+        void next_chunk(size_t min_size)
+        {
+            if (current_)
+                ++current_chunk_;
+
+            // reuse chunks left after reset()
+            while (current_chunk_ < chunks_.size() && chunks_[current_chunk_].size < min_size)
+                ++current_chunk_;
+
+            if (current_chunk_ >= chunks_.size())
+            {
+                const size_t size = std::max(chunk_size_ << std::min<size_t>(chunks_.size(), 8), min_size);
+                chunks_.push_back(Chunk{std::make_unique_for_overwrite<std::byte[]>(size), size});
+                current_chunk_ = chunks_.size() - 1;
+            }
+
+            current_ = chunks_[current_chunk_].memory.get();
+            remaining_ = chunks_[current_chunk_].size;
+        }
+    };
+}
+
+#endif
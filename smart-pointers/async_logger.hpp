@@ -0,0 +1,350 @@
+#ifndef ASYNC_LOGGER_HPP
+#define ASYNC_LOGGER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace AsyncLogging
+{
+    // custom deleter - same idea as file_closer in smart_pointers.cpp, but flushes before closing
+    struct FileCloser
+    {
+        void operator()(FILE* f) const
+        {
+            std::fflush(f);
+            std::fclose(f);
+        }
+    };
+
+    using FilePtr = std::unique_ptr<FILE, FileCloser>;
+
+    inline FilePtr open_log_file(const std::string& path)
+    {
+        FilePtr file{std::fopen(path.c_str(), "ab")};
+
+        if (!file)
+            throw std::runtime_error("Cannot open log file: " + path);
+
+        return file;
+    }
+
+    struct LogRecord
+    {
+        static constexpr size_t max_length = 232;
+
+        std::chrono::steady_clock::time_point timestamp;
+        size_t length = 0;
+        char text[max_length];
+
+        void append(std::string_view str)
+        {
+            const size_t count = std::min(str.size(), max_length - length);
+            std::memcpy(text + length, str.data(), count);
+            length += count;
+        }
+
+        void append(const char* str)
+        {
+            append(std::string_view{str});
+        }
+
+        void append(char c)
+        {
+            if (length < max_length)
+                text[length++] = c;
+        }
+
+        void append(bool value)
+        {
+            append(value ? std::string_view{"true"} : std::string_view{"false"});
+        }
+
+        template <typename T>
+            requires std::is_arithmetic_v<T>
+        void append(T value)
+        {
+            auto [end, ec] = std::to_chars(text + length, text + max_length, value);
+            if (ec == std::errc{})
+                length = end - text;
+        }
+
+        std::string_view view() const
+        {
+            return {text, length};
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // bounded MPSC queue of preallocated records (Vyukov's sequence-number ring)
+    //  - producers format directly into the claimed slot - no allocation on the hot path
+    //  - single consumer, so the pop side needs no CAS
+    class MpscRecordQueue
+    {
+        struct alignas(64) Slot
+        {
+            std::atomic<size_t> sequence;
+            LogRecord record;
+        };
+
+        std::unique_ptr<Slot[]> slots_;
+        size_t mask_;
+        alignas(64) std::atomic<size_t> tail_{0};
+        alignas(64) size_t head_{0};
+
+    public:
+        explicit MpscRecordQueue(size_t capacity)
+            : slots_{std::make_unique<Slot[]>(capacity)}
+            , mask_{capacity - 1}
+        {
+            if (capacity < 2 || (capacity & mask_) != 0)
+                throw std::invalid_argument("Capacity must be a power of 2");
+
+            for (size_t i = 0; i < capacity; ++i)
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        template <typename TFormatter>
+        bool try_push(TFormatter&& formatter)
+        {
+            size_t pos = tail_.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                Slot& slot = slots_[pos & mask_];
+                const size_t seq = slot.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        slot.record.length = 0;
+                        formatter(slot.record);
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false; // full
+                }
+                else
+                {
+                    pos = tail_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // consumer side only
+        template <typename TConsumer>
+        bool try_pop(TConsumer&& consumer)
+        {
+            Slot& slot = slots_[head_ & mask_];
+
+            if (slot.sequence.load(std::memory_order_acquire) != head_ + 1)
+                return false; // empty
+
+            consumer(slot.record);
+            slot.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+            ++head_;
+
+            return true;
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // AsyncLogger
+    //  - producers: format into a queue slot and return
+    //  - drain thread: moves records into the front buffer
+    //  - writer thread: writes the back buffer to the file while the front one is being filled
+    class AsyncLogger
+    {
+    public:
+        struct Options
+        {
+            size_t queue_capacity = 8192;
+            size_t buffer_size = 64 * 1024;
+            std::chrono::microseconds idle_wait{200};
+        };
+
+    private:
+        const Options options_;
+        const std::chrono::steady_clock::time_point start_time_ = std::chrono::steady_clock::now();
+        MpscRecordQueue queue_;
+        FilePtr file_;
+
+        std::vector<char> front_buffer_;
+        std::vector<char> back_buffer_;
+        bool back_buffer_ready_ = false;
+        std::mutex mtx_buffers_;
+        std::condition_variable cv_buffers_;
+
+        std::atomic<size_t> dropped_count_{0};
+        std::atomic<size_t> written_count_{0};
+        std::atomic<bool> is_done_{false};
+
+        std::thread drain_thread_;
+        std::thread writer_thread_;
+
+    public:
+        explicit AsyncLogger(const std::string& path)
+            : AsyncLogger{open_log_file(path), Options{}}
+        {
+        }
+
+        AsyncLogger(const std::string& path, Options options)
+            : AsyncLogger{open_log_file(path), options}
+        {
+        }
+
+        AsyncLogger(FilePtr file, Options options)
+            : options_{options}
+            , queue_{options.queue_capacity}
+            , file_{std::move(file)}
+        {
+            front_buffer_.reserve(options_.buffer_size + LogRecord::max_length + 32);
+            back_buffer_.reserve(options_.buffer_size + LogRecord::max_length + 32);
+
+            writer_thread_ = std::thread{[this] { write_loop(); }};
+            drain_thread_ = std::thread{[this] { drain_loop(); }};
+        }
+
+        AsyncLogger(const AsyncLogger&) = delete;
+        AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+        ~AsyncLogger()
+        {
+            is_done_.store(true, std::memory_order_release);
+            drain_thread_.join(); // drains the queue & hands over the last buffer
+
+            swap_buffers(); // front buffer is empty now - empty hand-over stops the writer
+            writer_thread_.join();
+        } // file_ is flushed & closed by FileCloser
+
+        template <typename... TArgs>
+        bool try_log(const TArgs&... args)
+        {
+            const bool is_pushed = queue_.try_push([&](LogRecord& record) {
+                record.timestamp = std::chrono::steady_clock::now();
+                (record.append(args), ...);
+            });
+
+            if (!is_pushed)
+                dropped_count_.fetch_add(1, std::memory_order_relaxed);
+
+            return is_pushed;
+        }
+
+        // blocks (spinning) while the queue is full
+        template <typename... TArgs>
+        void log(const TArgs&... args)
+        {
+            auto formatter = [&](LogRecord& record) {
+                record.timestamp = std::chrono::steady_clock::now();
+                (record.append(args), ...);
+            };
+
+            while (!queue_.try_push(formatter))
+                std::this_thread::yield();
+        }
+
+        size_t dropped_count() const
+        {
+            return dropped_count_.load(std::memory_order_relaxed);
+        }
+
+        size_t written_count() const
+        {
+            return written_count_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void append_to_front_buffer(const LogRecord& record)
+        {
+            char prefix[32];
+            const auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(record.timestamp - start_time_).count();
+
+            prefix[0] = '[';
+            auto [end, ec] = std::to_chars(prefix + 1, prefix + sizeof(prefix) - 2, elapsed_us);
+            *end++ = ']';
+            *end++ = ' ';
+
+            front_buffer_.insert(front_buffer_.end(), prefix, end);
+            front_buffer_.insert(front_buffer_.end(), record.text, record.text + record.length);
+            front_buffer_.push_back('\n');
+        }
+
+        void swap_buffers()
+        {
+            std::unique_lock lk{mtx_buffers_};
+            cv_buffers_.wait(lk, [this] { return !back_buffer_ready_; });
+
+            front_buffer_.swap(back_buffer_);
+            back_buffer_ready_ = true;
+            lk.unlock();
+
+            cv_buffers_.notify_all();
+        }
+
+        void drain_loop()
+        {
+            auto append = [this](const LogRecord& record) { append_to_front_buffer(record); };
+
+            for (;;)
+            {
+                const bool is_done = is_done_.load(std::memory_order_acquire);
+
+                size_t count = 0;
+                while (front_buffer_.size() < options_.buffer_size && queue_.try_pop(append))
+                    ++count;
+
+                written_count_.fetch_add(count, std::memory_order_relaxed);
+
+                if (front_buffer_.size() >= options_.buffer_size || (count == 0 && !front_buffer_.empty()))
+                    swap_buffers();
+                else if (count == 0 && is_done)
+                    return;
+                else if (count == 0)
+                    std::this_thread::sleep_for(options_.idle_wait);
+            }
+        }
+
+        void write_loop()
+        {
+            for (;;)
+            {
+                std::unique_lock lk{mtx_buffers_};
+                cv_buffers_.wait(lk, [this] { return back_buffer_ready_; });
+
+                if (back_buffer_.empty())
+                    return; // empty hand-over - the logger is shutting down
+
+                lk.unlock();
+
+                std::fwrite(back_buffer_.data(), 1, back_buffer_.size(), file_.get());
+                back_buffer_.clear();
+
+                lk.lock();
+                back_buffer_ready_ = false;
+                lk.unlock();
+
+                cv_buffers_.notify_all();
+            }
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,205 @@
+#ifndef EPOCH_RECLAMATION_HPP
+#define EPOCH_RECLAMATION_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace LockFree
+{
+    /////////////////////////////////////////////////////////////////////////////
+    // EpochDomain - epoch based reclamation (EBR)
+    //  - a reader pins the current global epoch for the duration of an operation
+    //  - retired objects go to the limbo list of the current global epoch
+    //  - the global epoch advances only when all pinned threads have observed it,
+    //    so objects retired two epochs ago cannot be referenced anymore and are deleted
+    //  - readers pay one atomic exchange per operation (no per-pointer publication),
+    //    but a single stalled reader blocks reclamation of everything
+    class EpochDomain
+    {
+    public:
+        static constexpr size_t max_participants = 256;
+
+    private:
+        static constexpr uint64_t pinned_flag = 1;
+
+        struct alignas(64) Record
+        {
+            std::atomic<uint64_t> state{0}; // (epoch << 1) | pinned_flag
+            std::atomic<bool> is_active{false};
+        };
+
+        struct Retired
+        {
+            void* object;
+            void (*deleter)(void*);
+            std::chrono::steady_clock::time_point retired_at;
+            Retired* next;
+        };
+
+        alignas(64) std::atomic<uint64_t> global_epoch_{0};
+        Record records_[max_participants];
+        std::atomic<Retired*> limbo_[3] = {};
+        std::atomic<size_t> retired_count_{0};
+        std::atomic<size_t> retires_since_advance_{0};
+        const size_t advance_threshold_;
+
+        std::atomic<size_t> reclaimed_count_{0};
+        std::atomic<int64_t> reclamation_latency_ns_{0};
+
+    public:
+        class EpochGuard
+        {
+            Record* record_;
+            uint64_t epoch_;
+
+        public:
+            EpochGuard(Record* record, uint64_t epoch)
+                : record_{record}
+                , epoch_{epoch}
+            {
+                record_->state.exchange((epoch_ << 1) | pinned_flag, std::memory_order_seq_cst); // full barrier
+            }
+
+            EpochGuard(const EpochGuard&) = delete;
+            EpochGuard& operator=(const EpochGuard&) = delete;
+
+            ~EpochGuard()
+            {
+                record_->state.store(epoch_ << 1, std::memory_order_release);
+                record_->is_active.store(false, std::memory_order_release);
+            }
+
+            // pinned epoch protects everything reachable - no per-pointer publication
+            template <typename T>
+            T* protect(const std::atomic<T*>& src)
+            {
+                return src.load(std::memory_order_acquire);
+            }
+
+            void reset()
+            {
+            }
+        };
+
+        using Guard = EpochGuard;
+
+        explicit EpochDomain(size_t advance_threshold = 64)
+            : advance_threshold_{advance_threshold}
+        {
+        }
+
+        EpochDomain(const EpochDomain&) = delete;
+        EpochDomain& operator=(const EpochDomain&) = delete;
+
+        ~EpochDomain()
+        {
+            for (auto& limbo : limbo_)
+                delete_all(limbo.exchange(nullptr));
+        }
+
+        EpochGuard make_guard()
+        {
+            thread_local size_t hint = 0;
+
+            for (size_t i = 0; i < max_participants; ++i)
+            {
+                Record& record = records_[(hint + i) % max_participants];
+
+                if (!record.is_active.load(std::memory_order_relaxed) && !record.is_active.exchange(true, std::memory_order_acquire))
+                {
+                    hint = (hint + i) % max_participants;
+                    return EpochGuard{&record, global_epoch_.load(std::memory_order_seq_cst)};
+                }
+            }
+
+            throw std::runtime_error("Too many threads in epoch domain");
+        }
+
+        template <typename T>
+        void retire(const EpochGuard& guard, T* object)
+        {
+            retire(guard, object, [](void* ptr) { delete static_cast<T*>(ptr); });
+        }
+
+        // must be called while pinned - the global epoch cannot move more than one step ahead then
+        //  - the object is tagged with the global epoch, not the pinned one: the pinned epoch may lag
+        //    behind by one and readers pinned in the newer epoch may still hold the object
+        void retire(const EpochGuard&, void* object, void (*deleter)(void*))
+        {
+            auto* node = new Retired{object, deleter, std::chrono::steady_clock::now(), nullptr};
+
+            const uint64_t epoch = global_epoch_.load(std::memory_order_seq_cst);
+            auto& limbo = limbo_[epoch % 3];
+            node->next = limbo.load(std::memory_order_relaxed);
+            while (!limbo.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+                ;
+
+            retired_count_.fetch_add(1, std::memory_order_relaxed);
+
+            if (retires_since_advance_.fetch_add(1, std::memory_order_relaxed) + 1 >= advance_threshold_)
+                try_advance();
+        }
+
+        // advances the global epoch if every pinned thread has observed it
+        bool try_advance()
+        {
+            uint64_t epoch = global_epoch_.load(std::memory_order_seq_cst);
+
+            for (const auto& record : records_)
+            {
+                const uint64_t state = record.state.load(std::memory_order_seq_cst);
+                if ((state & pinned_flag) && (state >> 1) != epoch)
+                    return false;
+            }
+
+            if (!global_epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel))
+                return false;
+
+            retires_since_advance_.store(0, std::memory_order_relaxed);
+
+            // objects retired in (epoch - 1) are no longer reachable by any pinned thread
+            delete_all(limbo_[(epoch + 2) % 3].exchange(nullptr, std::memory_order_acquire));
+
+            return true;
+        }
+
+        size_t pending_count() const
+        {
+            return retired_count_.load(std::memory_order_relaxed);
+        }
+
+        size_t reclaimed_count() const
+        {
+            return reclaimed_count_.load(std::memory_order_relaxed);
+        }
+
+        std::chrono::nanoseconds total_reclamation_latency() const
+        {
+            return std::chrono::nanoseconds{reclamation_latency_ns_.load(std::memory_order_relaxed)};
+        }
+
+    private:
+        void delete_all(Retired* list)
+        {
+            while (list)
+            {
+                Retired* node = list;
+                list = list->next;
+
+                const auto latency = std::chrono::steady_clock::now() - node->retired_at;
+
+                node->deleter(node->object);
+                delete node;
+
+                retired_count_.fetch_sub(1, std::memory_order_relaxed);
+                reclaimed_count_.fetch_add(1, std::memory_order_relaxed);
+                reclamation_latency_ns_.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count(), std::memory_order_relaxed);
+            }
+        }
+    };
+}
+
+#endif
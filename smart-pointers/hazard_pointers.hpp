@@ -0,0 +1,244 @@
+#ifndef HAZARD_POINTERS_HPP
+#define HAZARD_POINTERS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace LockFree
+{
+    /////////////////////////////////////////////////////////////////////////////
+    // HazardDomain - safe memory reclamation with hazard pointers
+    //  - a reader publishes the pointer it is going to dereference (protect)
+    //  - a writer that unlinked an object hands it over to the domain (retire)
+    //  - when the number of retired objects reaches the threshold they are scanned
+    //    and only objects not published by any reader are deleted
+    class HazardDomain
+    {
+    public:
+        static constexpr size_t max_hazard_pointers = 256;
+
+    private:
+        struct alignas(64) Record
+        {
+            std::atomic<const void*> pointer{nullptr};
+            std::atomic<bool> is_active{false};
+        };
+
+        struct Retired
+        {
+            void* object;
+            void (*deleter)(void*);
+            std::chrono::steady_clock::time_point retired_at;
+            Retired* next;
+        };
+
+        Record records_[max_hazard_pointers];
+        std::atomic<Retired*> retired_{nullptr};
+        std::atomic<size_t> retired_count_{0};
+        const size_t scan_threshold_;
+
+        std::atomic<size_t> reclaimed_count_{0};
+        std::atomic<int64_t> reclamation_latency_ns_{0};
+
+    public:
+        class HazardPointer
+        {
+            Record* record_;
+
+        public:
+            explicit HazardPointer(Record* record)
+                : record_{record}
+            {
+            }
+
+            HazardPointer(const HazardPointer&) = delete;
+            HazardPointer& operator=(const HazardPointer&) = delete;
+
+            ~HazardPointer()
+            {
+                record_->pointer.store(nullptr, std::memory_order_release);
+                record_->is_active.store(false, std::memory_order_release);
+            }
+
+            // returns value of src that is safe to dereference until reset() or the next protect()
+            template <typename T>
+            T* protect(const std::atomic<T*>& src)
+            {
+                T* ptr = src.load(std::memory_order_relaxed);
+
+                for (;;)
+                {
+                    record_->pointer.store(ptr, std::memory_order_seq_cst);
+
+                    T* current = src.load(std::memory_order_seq_cst);
+                    if (current == ptr)
+                        return ptr;
+
+                    ptr = current;
+                }
+            }
+
+            void reset()
+            {
+                record_->pointer.store(nullptr, std::memory_order_release);
+            }
+        };
+
+        using Guard = HazardPointer;
+
+        explicit HazardDomain(size_t scan_threshold = 2 * max_hazard_pointers)
+            : scan_threshold_{scan_threshold}
+        {
+        }
+
+        HazardDomain(const HazardDomain&) = delete;
+        HazardDomain& operator=(const HazardDomain&) = delete;
+
+        ~HazardDomain()
+        {
+            delete_all(retired_.exchange(nullptr));
+        }
+
+        HazardPointer make_guard()
+        {
+            thread_local size_t hint = 0;
+
+            for (size_t i = 0; i < max_hazard_pointers; ++i)
+            {
+                Record& record = records_[(hint + i) % max_hazard_pointers];
+
+                if (!record.is_active.load(std::memory_order_relaxed) && !record.is_active.exchange(true, std::memory_order_acquire))
+                {
+                    hint = (hint + i) % max_hazard_pointers;
+                    return HazardPointer{&record};
+                }
+            }
+
+            throw std::runtime_error("No free hazard pointers");
+        }
+
+        template <typename T>
+        void retire(T* object)
+        {
+            retire(object, [](void* ptr) { delete static_cast<T*>(ptr); });
+        }
+
+        // the same interface as EpochDomain::retire() - hazard pointers do not need the guard
+        template <typename T>
+        void retire(const HazardPointer&, T* object)
+        {
+            retire(object);
+        }
+
+        void retire(void* object, void (*deleter)(void*))
+        {
+            push_retired(new Retired{object, deleter, std::chrono::steady_clock::now(), nullptr}, 1);
+
+            if (retired_count_.load(std::memory_order_relaxed) >= scan_threshold_)
+                scan();
+        }
+
+        // deletes all retired objects that are not protected by any hazard pointer
+        void scan()
+        {
+            Retired* list = retired_.exchange(nullptr, std::memory_order_acquire);
+            if (!list)
+                return;
+
+            std::vector<const void*> hazards;
+            hazards.reserve(max_hazard_pointers);
+            for (const auto& record : records_)
+            {
+                if (const void* ptr = record.pointer.load(std::memory_order_seq_cst))
+                    hazards.push_back(ptr);
+            }
+            std::sort(hazards.begin(), hazards.end());
+
+            Retired* still_protected = nullptr;
+            Retired* still_protected_tail = nullptr;
+            size_t taken_count = 0;
+            size_t kept_count = 0;
+
+            while (list)
+            {
+                Retired* node = list;
+                list = list->next;
+                ++taken_count;
+
+                if (std::binary_search(hazards.begin(), hazards.end(), node->object))
+                {
+                    node->next = still_protected;
+                    still_protected = node;
+                    if (!still_protected_tail)
+                        still_protected_tail = node;
+                    ++kept_count;
+                }
+                else
+                {
+                    reclaim(node);
+                }
+            }
+
+            retired_count_.fetch_sub(taken_count, std::memory_order_relaxed);
+
+            if (still_protected)
+                push_retired(still_protected, kept_count, still_protected_tail);
+        }
+
+        size_t pending_count() const
+        {
+            return retired_count_.load(std::memory_order_relaxed);
+        }
+
+        size_t reclaimed_count() const
+        {
+            return reclaimed_count_.load(std::memory_order_relaxed);
+        }
+
+        std::chrono::nanoseconds total_reclamation_latency() const
+        {
+            return std::chrono::nanoseconds{reclamation_latency_ns_.load(std::memory_order_relaxed)};
+        }
+
+    private:
+        void push_retired(Retired* first, size_t count, Retired* last = nullptr)
+        {
+            if (!last)
+                last = first;
+
+            retired_count_.fetch_add(count, std::memory_order_relaxed);
+
+            last->next = retired_.load(std::memory_order_relaxed);
+            while (!retired_.compare_exchange_weak(last->next, first, std::memory_order_release, std::memory_order_relaxed))
+                ;
+        }
+
+        void reclaim(Retired* node)
+        {
+            const auto latency = std::chrono::steady_clock::now() - node->retired_at;
+
+            node->deleter(node->object);
+            delete node;
+
+            reclaimed_count_.fetch_add(1, std::memory_order_relaxed);
+            reclamation_latency_ns_.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count(), std::memory_order_relaxed);
+        }
+
+        void delete_all(Retired* list)
+        {
+            while (list)
+            {
+                Retired* node = list;
+                list = list->next;
+                reclaim(node);
+            }
+        }
+    };
+}
+
+#endif
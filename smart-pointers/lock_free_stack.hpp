@@ -0,0 +1,77 @@
+#ifndef LOCK_FREE_STACK_HPP
+#define LOCK_FREE_STACK_HPP
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace LockFree
+{
+    /////////////////////////////////////////////////////////////////////////////
+    // Treiber stack - reference client of the reclamation domains
+    //  TDomain: HazardDomain or EpochDomain
+    //   - make_guard() returns a guard with protect(const atomic<T*>&)
+    //   - retire(guard, ptr) defers deletion of an unlinked node
+    template <typename T, typename TDomain>
+    class LockFreeStack
+    {
+        struct Node
+        {
+            T value;
+            Node* next;
+        };
+
+        std::atomic<Node*> head_{nullptr};
+        TDomain& domain_;
+
+    public:
+        explicit LockFreeStack(TDomain& domain)
+            : domain_{domain}
+        {
+        }
+
+        LockFreeStack(const LockFreeStack&) = delete;
+        LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+        ~LockFreeStack()
+        {
+            Node* node = head_.load(std::memory_order_relaxed);
+            while (node)
+                delete std::exchange(node, node->next);
+        }
+
+        template <typename... TArgs>
+        void push(TArgs&&... args)
+        {
+            Node* node = new Node{T(std::forward<TArgs>(args)...), head_.load(std::memory_order_relaxed)};
+
+            while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+                ;
+        }
+
+        std::optional<T> pop()
+        {
+            auto guard = domain_.make_guard();
+
+            Node* old_head = guard.protect(head_);
+            while (old_head && !head_.compare_exchange_weak(old_head, old_head->next, std::memory_order_acquire, std::memory_order_relaxed))
+                old_head = guard.protect(head_);
+
+            if (!old_head)
+                return std::nullopt;
+
+            std::optional<T> result{std::move(old_head->value)}; // node is unlinked - only this thread owns it
+            guard.reset();
+            domain_.retire(guard, old_head);
+
+            return result;
+        }
+
+        bool empty() const
+        {
+            return head_.load(std::memory_order_acquire) == nullptr;
+        }
+    };
+}
+
+#endif
@@ -1,3 +1,4 @@
+#include "arena.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -70,14 +71,26 @@ TEST_CASE("Legacy hell with dynamic memory")
 namespace ModernCpp
 {
     std::unique_ptr<Gadget> get_gadget(const std::string& name);
+    Gadget* get_gadget(Memory::Arena& arena, const std::string& name);
     void use(std::unique_ptr<Gadget> g);
     void use_gadget(Gadget* g);
 
     // definitions
-    std::unique_ptr<Gadget> get_gadget(const std::string& name)
+    int next_gadget_id()
     {
         static int id = 665;
-        return std::make_unique<Gadget>(++id, name);
+        return ++id;
+    }
+
+    std::unique_ptr<Gadget> get_gadget(const std::string& name)
+    {
+        return std::make_unique<Gadget>(next_gadget_id(), name);
+    }
+
+    // returned pointer is non-owning - the gadget is destroyed by arena.reset() or ~Arena()
+    Gadget* get_gadget(Memory::Arena& arena, const std::string& name)
+    {
+        return arena.create<Gadget>(next_gadget_id(), name);
     }
 
     void use(std::unique_ptr<Gadget> g)
@@ -158,6 +171,24 @@ TEST_CASE("Safer code with smart pointers")
     }
 }
 
+TEST_CASE("Gadgets owned by arena")
+{
+    using namespace ModernCpp;
+
+    Memory::Arena arena;
+
+    Gadget* g1 = get_gadget(arena, "ipad");
+    Gadget* g2 = get_gadget(arena, "smartwatch");
+
+    use_gadget(g1);
+    use_gadget(g2);
+
+    REQUIRE(g2->id() == g1->id() + 1);
+    REQUIRE(g2->name() == "smartwatch");
+
+    arena.reset(); // ~Gadget(smartwatch), ~Gadget(ipad)
+}
+
 TEST_CASE("shared_ptrs & threads")
 {
     using namespace std::literals;
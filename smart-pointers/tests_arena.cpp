@@ -0,0 +1,141 @@
+#include "arena.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using Memory::Arena;
+
+namespace
+{
+    struct Tracked
+    {
+        inline static std::vector<int> destroyed;
+
+        int id;
+
+        explicit Tracked(int id)
+            : id{id}
+        {
+        }
+
+        ~Tracked()
+        {
+            destroyed.push_back(id);
+        }
+    };
+
+    struct alignas(64) OverAligned
+    {
+        char data[64];
+    };
+
+    // the same layout as Utils::Gadget - without logging in constructor & destructor
+    struct QuietGadget
+    {
+        int id;
+        std::string name;
+    };
+}
+
+TEST_CASE("Arena")
+{
+    Tracked::destroyed.clear();
+
+    Arena arena{128};
+
+    SECTION("creates objects")
+    {
+        Tracked* t1 = arena.create<Tracked>(1);
+        Tracked* t2 = arena.create<Tracked>(2);
+
+        REQUIRE(t1->id == 1);
+        REQUIRE(t2->id == 2);
+        REQUIRE(t1 != t2);
+    }
+
+    SECTION("respects alignment")
+    {
+        arena.create<char>('a');
+        auto* ptr = arena.create<OverAligned>();
+
+        REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % 64 == 0);
+    }
+
+    SECTION("allocates new chunks when needed")
+    {
+        for (int i = 0; i < 100; ++i)
+            arena.create<Tracked>(i);
+
+        REQUIRE(arena.capacity() > 128);
+
+        auto* big = arena.allocate(10'000);
+        REQUIRE(big != nullptr);
+    }
+
+    SECTION("reset destroys all objects in reverse order")
+    {
+        arena.create<Tracked>(1);
+        arena.create<Tracked>(2);
+        arena.create<Tracked>(3);
+
+        arena.reset();
+
+        REQUIRE(Tracked::destroyed == std::vector{3, 2, 1});
+
+        SECTION("memory is reused after reset")
+        {
+            const auto capacity = arena.capacity();
+
+            for (int i = 0; i < 3; ++i)
+                arena.create<Tracked>(i);
+
+            REQUIRE(arena.capacity() == capacity);
+        }
+    }
+
+    SECTION("destructor destroys remaining objects")
+    {
+        {
+            Arena local_arena;
+            local_arena.create<Tracked>(42);
+            local_arena.create<Tracked>(665);
+        }
+
+        REQUIRE(Tracked::destroyed == std::vector{665, 42});
+    }
+}
+
+TEST_CASE("Arena vs unique_ptr - per request create & teardown", "[.][benchmark]")
+{
+    constexpr int gadgets_per_request = 500;
+
+    BENCHMARK("unique_ptr")
+    {
+        std::vector<std::unique_ptr<QuietGadget>> gadgets;
+        gadgets.reserve(gadgets_per_request);
+
+        for (int i = 0; i < gadgets_per_request; ++i)
+            gadgets.push_back(std::make_unique<QuietGadget>(i, "gadget"));
+
+        return gadgets.size();
+    };
+
+    Arena arena{64 * 1024};
+
+    BENCHMARK("Arena")
+    {
+        std::vector<QuietGadget*> gadgets;
+        gadgets.reserve(gadgets_per_request);
+
+        for (int i = 0; i < gadgets_per_request; ++i)
+            gadgets.push_back(arena.create<QuietGadget>(i, "gadget"));
+
+        arena.reset();
+
+        return gadgets.size();
+    };
+}
@@ -0,0 +1,194 @@
+#include "async_logger.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace AsyncLogging;
+
+namespace
+{
+    std::filesystem::path temp_log_path(const std::string& name)
+    {
+        auto path = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove(path);
+        return path;
+    }
+
+    std::vector<std::string> read_lines(const std::filesystem::path& path)
+    {
+        std::ifstream in{path};
+        std::vector<std::string> lines;
+
+        for (std::string line; std::getline(in, line);)
+            lines.push_back(line);
+
+        return lines;
+    }
+}
+
+TEST_CASE("FileCloser flushes & closes file")
+{
+    auto path = temp_log_path("file_closer_test.log");
+
+    {
+        FilePtr file = open_log_file(path.string());
+        std::fputs("abc", file.get());
+    } // fflush + fclose
+
+    REQUIRE(read_lines(path) == std::vector<std::string>{"abc"});
+
+    REQUIRE_THROWS_AS(open_log_file("/not-existing-dir/log.txt"), std::runtime_error);
+}
+
+TEST_CASE("LogRecord formats arguments in place")
+{
+    LogRecord record;
+
+    record.append("State has been set to: ");
+    record.append(42);
+    record.append(' ');
+    record.append(std::string{"ok"});
+    record.append(' ');
+    record.append(true);
+
+    REQUIRE(record.view() == "State has been set to: 42 ok true");
+
+    SECTION("text is truncated to max_length")
+    {
+        record.append(std::string(1000, 'x'));
+        REQUIRE(record.length == LogRecord::max_length);
+    }
+}
+
+TEST_CASE("MpscRecordQueue")
+{
+    MpscRecordQueue queue{4};
+
+    for (int i = 0; i < 4; ++i)
+        REQUIRE(queue.try_push([i](LogRecord& r) { r.append(i); }));
+
+    SECTION("push fails when queue is full")
+    {
+        REQUIRE_FALSE(queue.try_push([](LogRecord& r) { r.append("overflow"); }));
+    }
+
+    SECTION("pop in FIFO order")
+    {
+        std::string result;
+        while (queue.try_pop([&](const LogRecord& r) { result += r.view(); }))
+            ;
+
+        REQUIRE(result == "0123");
+        REQUIRE(queue.try_push([](LogRecord& r) { r.append("again"); }));
+    }
+
+    SECTION("capacity must be a power of 2")
+    {
+        REQUIRE_THROWS_AS(MpscRecordQueue{6}, std::invalid_argument);
+    }
+}
+
+TEST_CASE("AsyncLogger")
+{
+    auto path = temp_log_path("async_logger_test.log");
+
+    constexpr int no_of_producers = 4;
+    constexpr int no_of_records = 1'000;
+
+    {
+        AsyncLogger logger{path.string(), AsyncLogger::Options{.queue_capacity = 256, .buffer_size = 4096}};
+
+        std::vector<std::thread> producers;
+        for (int id = 0; id < no_of_producers; ++id)
+        {
+            producers.emplace_back([&logger, id] {
+                for (int i = 0; i < no_of_records; ++i)
+                    logger.log("producer#", id, ": event ", i);
+            });
+        }
+
+        for (auto& thd : producers)
+            thd.join();
+    } // all records are drained & written before the file is closed
+
+    auto lines = read_lines(path);
+    REQUIRE(lines.size() == no_of_producers * no_of_records);
+
+    SECTION("each line is prefixed with a timestamp")
+    {
+        REQUIRE(std::all_of(lines.begin(), lines.end(), [](const std::string& line) {
+            return line.starts_with('[') && line.find("] producer#") != std::string::npos;
+        }));
+    }
+
+    SECTION("records of a single producer keep their order")
+    {
+        int expected = 0;
+        for (const auto& line : lines)
+        {
+            if (line.find("producer#0: ") == std::string::npos)
+                continue;
+
+            REQUIRE(line.ends_with("event " + std::to_string(expected)));
+            ++expected;
+        }
+        REQUIRE(expected == no_of_records);
+    }
+}
+
+TEST_CASE("AsyncLogger - producer latency", "[.][benchmark]")
+{
+    using namespace std::literals;
+
+    auto path = temp_log_path("async_logger_bench.log");
+
+    constexpr int no_of_producers = 16;
+    constexpr int no_of_records = 20'000;
+
+    std::vector<std::vector<std::chrono::nanoseconds>> latencies(no_of_producers);
+
+    {
+        AsyncLogger logger{path.string(), AsyncLogger::Options{.queue_capacity = 64 * 1024, .buffer_size = 256 * 1024}};
+
+        std::vector<std::thread> producers;
+        for (int id = 0; id < no_of_producers; ++id)
+        {
+            producers.emplace_back([&logger, &latencies, id] {
+                auto& results = latencies[id];
+                results.reserve(no_of_records);
+
+                for (int i = 0; i < no_of_records; ++i)
+                {
+                    auto start = std::chrono::steady_clock::now();
+                    logger.log("producer#", id, ": event ", i, " value: ", i * 0.5);
+                    results.push_back(std::chrono::steady_clock::now() - start);
+                }
+            });
+        }
+
+        for (auto& thd : producers)
+            thd.join();
+    }
+
+    std::vector<std::chrono::nanoseconds> all;
+    for (const auto& results : latencies)
+        all.insert(all.end(), results.begin(), results.end());
+
+    std::sort(all.begin(), all.end());
+
+    auto percentile = [&all](double p) { return all[static_cast<size_t>(p * (all.size() - 1))].count(); };
+
+    std::cout << "AsyncLogger - " << no_of_producers << " producers, " << all.size() << " records\n"
+              << "  p50: " << percentile(0.50) << "ns\n"
+              << "  p99: " << percentile(0.99) << "ns\n"
+              << "  max: " << all.back().count() << "ns\n";
+
+    REQUIRE(read_lines(path).size() == all.size());
+}
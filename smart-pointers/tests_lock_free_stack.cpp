@@ -0,0 +1,233 @@
+#include "epoch_reclamation.hpp"
+#include "hazard_pointers.hpp"
+#include "lock_free_stack.hpp"
+#include "utils.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace LockFree;
+
+namespace
+{
+    struct Counted
+    {
+        inline static std::atomic<int> instances{0};
+
+        int value;
+
+        explicit Counted(int value)
+            : value{value}
+        {
+            ++instances;
+        }
+
+        Counted(const Counted& other)
+            : value{other.value}
+        {
+            ++instances;
+        }
+
+        ~Counted()
+        {
+            --instances;
+        }
+    };
+}
+
+TEST_CASE("HazardDomain")
+{
+    Counted::instances = 0;
+
+    HazardDomain domain{1};
+    std::atomic<Counted*> shared{new Counted{42}};
+
+    SECTION("protected object is not reclaimed")
+    {
+        auto hp = domain.make_guard();
+        Counted* ptr = hp.protect(shared);
+
+        shared.store(nullptr);
+        domain.retire(ptr);
+        domain.scan();
+
+        REQUIRE(Counted::instances == 1);
+        REQUIRE(ptr->value == 42);
+        REQUIRE(domain.pending_count() == 1);
+
+        SECTION("object is reclaimed after protection is released")
+        {
+            hp.reset();
+            domain.scan();
+
+            REQUIRE(Counted::instances == 0);
+            REQUIRE(domain.pending_count() == 0);
+            REQUIRE(domain.reclaimed_count() == 1);
+        }
+    }
+
+    SECTION("unprotected object is reclaimed when threshold is reached")
+    {
+        domain.retire(shared.exchange(nullptr));
+
+        REQUIRE(Counted::instances == 0);
+    }
+}
+
+TEST_CASE("EpochDomain")
+{
+    Counted::instances = 0;
+
+    EpochDomain domain{1'000};
+
+    SECTION("object retired while another thread is pinned is not reclaimed")
+    {
+        auto reader = domain.make_guard();
+
+        {
+            auto writer = domain.make_guard();
+            domain.retire(writer, new Counted{42});
+        }
+
+        domain.try_advance();
+        domain.try_advance();
+        domain.try_advance();
+
+        REQUIRE(Counted::instances == 1);
+        REQUIRE(domain.pending_count() == 1);
+    }
+
+    SECTION("object is reclaimed after two epoch advances")
+    {
+        {
+            auto writer = domain.make_guard();
+            domain.retire(writer, new Counted{42});
+        }
+
+        REQUIRE(domain.try_advance());
+        REQUIRE(Counted::instances == 1);
+
+        REQUIRE(domain.try_advance());
+        REQUIRE(Counted::instances == 0);
+        REQUIRE(domain.reclaimed_count() == 1);
+    }
+
+    SECTION("destructor reclaims remaining objects")
+    {
+        {
+            EpochDomain local_domain;
+            auto guard = local_domain.make_guard();
+            local_domain.retire(guard, new Counted{665});
+        }
+
+        REQUIRE(Counted::instances == 0);
+    }
+}
+
+TEST_CASE("LockFreeStack of Gadgets")
+{
+    HazardDomain domain;
+    LockFreeStack<Utils::Gadget, HazardDomain> stack{domain};
+
+    stack.push(1, "ipad");
+    stack.push(2, "smartwatch");
+
+    auto g = stack.pop();
+    REQUIRE(g->name() == "smartwatch");
+
+    g = stack.pop();
+    REQUIRE(g->name() == "ipad");
+
+    REQUIRE(stack.empty());
+    REQUIRE_FALSE(stack.pop().has_value());
+}
+
+TEMPLATE_TEST_CASE("LockFreeStack - stress test", "[stress]", HazardDomain, EpochDomain)
+{
+    Counted::instances = 0;
+
+    constexpr int no_of_threads = 4;
+    constexpr int no_of_items = 10'000;
+
+    std::atomic<long long> popped_sum{0};
+
+    {
+        TestType domain;
+        LockFreeStack<Counted, TestType> stack{domain};
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < no_of_threads; ++t)
+        {
+            threads.emplace_back([&stack, &popped_sum, t] {
+                long long local_sum = 0;
+
+                for (int i = 0; i < no_of_items; ++i)
+                {
+                    stack.push(t * no_of_items + i);
+
+                    if (auto item = stack.pop())
+                        local_sum += item->value;
+                }
+
+                popped_sum += local_sum;
+            });
+        }
+
+        for (auto& thd : threads)
+            thd.join();
+
+        while (auto item = stack.pop())
+            popped_sum += item->value;
+
+        REQUIRE(domain.reclaimed_count() + domain.pending_count() == no_of_threads * no_of_items);
+    }
+
+    const long long n = no_of_threads * no_of_items;
+    REQUIRE(popped_sum == n * (n - 1) / 2);
+    REQUIRE(Counted::instances == 0);
+}
+
+TEMPLATE_TEST_CASE("LockFreeStack - reclamation throughput & latency", "[.][benchmark]", HazardDomain, EpochDomain)
+{
+    constexpr int no_of_items = 200'000;
+
+    for (int no_of_threads : {1, 2, 4, 8})
+    {
+        BENCHMARK_ADVANCED("push+pop x 200'000 - threads: " + std::to_string(no_of_threads))(Catch::Benchmark::Chronometer meter)
+        {
+            TestType domain;
+            LockFreeStack<int, TestType> stack{domain};
+
+            meter.measure([&] {
+                std::vector<std::thread> threads;
+                for (int t = 0; t < no_of_threads; ++t)
+                {
+                    threads.emplace_back([&stack] {
+                        for (int i = 0; i < no_of_items; ++i)
+                        {
+                            stack.push(i);
+                            stack.pop();
+                        }
+                    });
+                }
+
+                for (auto& thd : threads)
+                    thd.join();
+            });
+
+            while (stack.pop())
+                ;
+
+            // every pushed node is retired once - either already reclaimed or still pending
+            const auto reclaimed = domain.reclaimed_count();
+            INFO("avg reclamation latency: " << (reclaimed ? domain.total_reclamation_latency().count() / reclaimed : 0) << "ns, "
+                                             << "pending: " << domain.pending_count());
+            REQUIRE(reclaimed + domain.pending_count() == static_cast<size_t>(meter.runs()) * no_of_threads * no_of_items);
+        };
+    }
+}
@@ -0,0 +1,347 @@
+#ifndef CALC_STATS_HPP
+#define CALC_STATS_HPP
+
+#include "block_moments.hpp"
+#include "simd_dispatch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+
+namespace Parallel
+{
+    /////////////////////////////////////////////////////////////////////////////
+    // QuantileSketch - fixed-size histogram of ints with logarithmic buckets (HDR-like)
+    //  - bucket of a value: sign, exponent & 5 top bits of mantissa of float(value)
+    //    -> relative error of a percentile below 1/32, values with magnitude below 64 are exact
+    //  - merging adds counts - sketches of chunks merge without any loss
+    class QuantileSketch
+    {
+    public:
+        static constexpr int mantissa_bits = 5;
+        static constexpr uint32_t first_key = 127u << mantissa_bits; // key of 1.0f
+        static constexpr uint32_t magnitude_buckets = (158u << mantissa_bits) - first_key + 2; // 0, 1 ... 2^31
+        static constexpr uint32_t zero_bucket = magnitude_buckets - 1;
+        static constexpr size_t no_of_buckets = 2 * magnitude_buckets - 1;
+
+    private:
+        std::array<uint64_t, no_of_buckets> counts_{};
+        uint64_t total_ = 0;
+
+    public:
+        static constexpr uint32_t bucket_of(int value)
+        {
+            const uint32_t bits = std::bit_cast<uint32_t>(static_cast<float>(value));
+            const uint32_t key = (bits & 0x7FFF'FFFF) >> (23 - mantissa_bits);
+            const uint32_t magnitude_bucket = key == 0 ? 0 : key - first_key + 1;
+
+            return (bits >> 31) ? zero_bucket - magnitude_bucket : zero_bucket + magnitude_bucket;
+        }
+
+        // middle of the range of values in the bucket
+        static int64_t value_of(uint32_t bucket)
+        {
+            const bool is_negative = bucket < zero_bucket;
+            const uint32_t magnitude_bucket = is_negative ? zero_bucket - bucket : bucket - zero_bucket;
+
+            if (magnitude_bucket == 0)
+                return 0;
+
+            const uint32_t key = magnitude_bucket + first_key - 1;
+            const double lower = std::bit_cast<float>(key << (23 - mantissa_bits));
+            const double upper = std::bit_cast<float>((key + 1) << (23 - mantissa_bits));
+            const auto magnitude = static_cast<int64_t>(std::floor((lower + upper) / 2));
+
+            return is_negative ? -magnitude : magnitude;
+        }
+
+        void add(int value)
+        {
+            ++counts_[bucket_of(value)];
+            ++total_;
+        }
+
+        void add_to_bucket(uint32_t bucket, uint64_t count = 1)
+        {
+            counts_[bucket] += count;
+            total_ += count;
+        }
+
+        void merge(const QuantileSketch& other)
+        {
+            for (size_t i = 0; i < no_of_buckets; ++i)
+                counts_[i] += other.counts_[i];
+            total_ += other.total_;
+        }
+
+        uint64_t count() const
+        {
+            return total_;
+        }
+
+        // nearest-rank percentile, p in [0, 100]
+        int64_t percentile(double p) const
+        {
+            if (total_ == 0)
+                throw std::out_of_range("Percentile of an empty sketch");
+            if (!(p >= 0.0 && p <= 100.0))
+                throw std::out_of_range("Percentile must be in [0, 100]");
+
+            const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total_))));
+
+            uint64_t cumulative = 0;
+            for (uint32_t bucket = 0; bucket < no_of_buckets; ++bucket)
+            {
+                cumulative += counts_[bucket];
+                if (cumulative >= rank)
+                    return value_of(bucket);
+            }
+
+            return value_of(no_of_buckets - 1);
+        }
+    };
+
+    namespace Details
+    {
+        inline void add_to_sketch_scalar(const int* values, size_t size, QuantileSketch& sketch)
+        {
+            for (size_t i = 0; i < size; ++i)
+                sketch.add(values[i]);
+        }
+
+#ifdef SIMD_HAS_AVX2_PATH
+        // same buckets as QuantileSketch::bucket_of() - cvtepi32_ps rounds like static_cast<float>
+        SIMD_TARGET_AVX2 inline __m256i sketch_buckets(__m256i values)
+        {
+            const __m256i bits = _mm256_castps_si256(_mm256_cvtepi32_ps(values));
+            const __m256i key = _mm256_srli_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7FFF'FFFF)), 23 - QuantileSketch::mantissa_bits);
+            const __m256i magnitude_bucket = _mm256_max_epi32(_mm256_sub_epi32(key, _mm256_set1_epi32(QuantileSketch::first_key - 1)), _mm256_setzero_si256());
+
+            const __m256i sign = _mm256_srai_epi32(values, 31); // -1 for negative values
+            const __m256i signed_bucket = _mm256_sub_epi32(_mm256_xor_si256(magnitude_bucket, sign), sign);
+
+            return _mm256_add_epi32(signed_bucket, _mm256_set1_epi32(QuantileSketch::zero_bucket));
+        }
+
+        struct SketchVectors
+        {
+            QuantileSketch* sketch;
+
+            SIMD_TARGET_AVX2 void operator()(__m256i values) const
+            {
+                alignas(32) uint32_t buckets[8];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(buckets), sketch_buckets(values));
+                for (uint32_t bucket : buckets)
+                    sketch->add_to_bucket(bucket);
+            }
+        };
+#endif
+
+        // buckets of the sketch are computed in the 1st pass of the moments kernel (AVX2) - scatter of counts
+        // overlaps with the arithmetic of the kernel
+        inline Numerics::Moments<int> block_moments(const int* values, size_t size, QuantileSketch& sketch)
+        {
+#ifdef SIMD_HAS_AVX2_PATH
+            if (Simd::cpu_has_avx2())
+            {
+                const auto moments = Numerics::block_moments_avx2(values, size, SketchVectors{&sketch});
+                const size_t visited = size - size % 8;
+                add_to_sketch_scalar(values + visited, size - visited, sketch);
+                return moments;
+            }
+#endif
+            add_to_sketch_scalar(values, size, sketch);
+            return Numerics::block_moments_scalar(values, size);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // StatsAccumulator - streaming min, max, avg, variance & percentiles of ints
+    //  - update(value) - one value at a time (Welford's method)
+    //  - update(span) - blocks of values with SIMD
+    //  - merge() - partial results of chunks (Chan's formula for variance)
+    //  - sum is exact (int64) - avg does not depend on the order of updates & merges
+    class StatsAccumulator
+    {
+        size_t count_ = 0;
+        int64_t sum_ = 0;
+        double m2_ = 0.0; // sum of squared deviations from the mean
+        int min_ = INT_MAX;
+        int max_ = INT_MIN;
+        QuantileSketch sketch_;
+
+    public:
+        void update(int value)
+        {
+            const double delta = value - avg_or_zero();
+
+            ++count_;
+            sum_ += value;
+            m2_ += delta * (value - avg_or_zero());
+
+            min_ = std::min(min_, value);
+            max_ = std::max(max_, value);
+            sketch_.add(value);
+        }
+
+        void update(std::span<const int> values)
+        {
+            for (size_t i = 0; i < values.size(); i += Numerics::moments_block_size)
+            {
+                const size_t size = std::min(Numerics::moments_block_size, values.size() - i);
+                merge(Details::block_moments(values.data() + i, size, sketch_));
+            }
+        }
+
+        void merge(const StatsAccumulator& other)
+        {
+            merge(Numerics::Moments<int>{other.count_, other.sum_, other.m2_, other.min_, other.max_});
+            sketch_.merge(other.sketch_);
+        }
+
+        size_t count() const
+        {
+            return count_;
+        }
+
+        int64_t sum() const
+        {
+            return sum_;
+        }
+
+        int min() const
+        {
+            ensure_not_empty();
+            return min_;
+        }
+
+        int max() const
+        {
+            ensure_not_empty();
+            return max_;
+        }
+
+        double avg() const
+        {
+            ensure_not_empty();
+            return avg_or_zero();
+        }
+
+        // population variance
+        double variance() const
+        {
+            ensure_not_empty();
+            return m2_ / static_cast<double>(count_);
+        }
+
+        double stddev() const
+        {
+            return std::sqrt(variance());
+        }
+
+        // approximate - see QuantileSketch (p0 & p100 are exact: min & max)
+        int64_t percentile(double p) const
+        {
+            const int64_t value = sketch_.percentile(p);
+
+            if (p == 0.0)
+                return min();
+            if (p == 100.0)
+                return max();
+            return std::clamp<int64_t>(value, min(), max());
+        }
+
+        int64_t median() const
+        {
+            return percentile(50.0);
+        }
+
+        // the same tuple as calc_stats()
+        std::tuple<int, int, double> min_max_avg() const
+        {
+            return std::tuple(min(), max(), avg());
+        }
+
+    private:
+        double avg_or_zero() const
+        {
+            return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_);
+        }
+
+        // counts of the sketch are merged separately
+        void merge(const Numerics::Moments<int>& other)
+        {
+            if (other.count == 0)
+                return;
+
+            const double delta = static_cast<double>(other.sum) / static_cast<double>(other.count) - avg_or_zero();
+            const size_t total_count = count_ + other.count;
+
+            m2_ += other.m2 + delta * delta * (static_cast<double>(count_) * static_cast<double>(other.count) / static_cast<double>(total_count));
+
+            count_ = total_count;
+            sum_ += other.sum;
+            min_ = std::min(min_, other.min);
+            max_ = std::max(max_, other.max);
+        }
+
+        void ensure_not_empty() const
+        {
+            if (count_ == 0)
+                throw std::out_of_range("Stats of an empty range");
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // calc_stats - single pass over data, chunk per thread
+    //  - no allocations for data - every thread updates its own accumulator (on its stack)
+    //    & merges it into the result (order of merges may change the last bits of variance)
+    //  - threads are kept in a fixed array - the only allocations are made by the runtime to start threads
+    //  - no_of_threads == 0 - std::thread::hardware_concurrency(), at most max_threads
+    inline constexpr size_t max_threads = 64;
+
+    inline StatsAccumulator calc_stats(std::span<const int> data, size_t no_of_threads = 0)
+    {
+        constexpr size_t min_chunk_size = 64 * 1024;
+
+        if (no_of_threads == 0)
+            no_of_threads = std::max(1u, std::thread::hardware_concurrency());
+        no_of_threads = std::clamp<size_t>(data.size() / min_chunk_size, 1, std::min(no_of_threads, max_threads));
+
+        StatsAccumulator result;
+        std::mutex mtx_result;
+
+        auto process_chunk = [&](size_t index) {
+            const size_t first = data.size() * index / no_of_threads;
+            const size_t last = data.size() * (index + 1) / no_of_threads;
+
+            StatsAccumulator partial;
+            partial.update(data.subspan(first, last - first));
+
+            std::lock_guard lk{mtx_result};
+            result.merge(partial);
+        };
+
+        {
+            std::array<std::jthread, max_threads - 1> threads;
+            for (size_t i = 1; i < no_of_threads; ++i)
+                threads[i - 1] = std::jthread{process_chunk, i};
+
+            process_chunk(0);
+        }
+
+        return result;
+    }
+}
+
+#endif
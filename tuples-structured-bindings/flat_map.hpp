@@ -0,0 +1,394 @@
+#ifndef FLAT_MAP_HPP
+#define FLAT_MAP_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Containers
+{
+    enum class SearchLayout
+    {
+        sorted,   // branchless binary search over sorted keys
+        eytzinger // keys copied in BFS order of a search tree - children of k at 2k & 2k + 1 (prefetch friendly)
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // flat_map - sorted dictionary stored in two vectors (keys & values)
+    //  - for small & read-mostly dictionaries: lookup touches only keys, iteration is a linear scan
+    //  - insert/erase of a single item is O(n) - use insert(first, last) for many items (one sort & merge)
+    //  - iterators return std::pair<const Key&, Value&> - structured bindings refer to stored items
+    //  - any modification invalidates iterators
+    template <typename Key, typename Value, typename Compare = std::less<Key>, SearchLayout Layout = SearchLayout::sorted>
+    class flat_map
+    {
+        std::vector<Key> keys_;
+        std::vector<Value> values_;
+        [[no_unique_address]] Compare comp_;
+
+        // Layout == eytzinger - rebuilt after every modification; [0] is not used
+        std::vector<Key> eytzinger_keys_;
+        std::vector<size_t> eytzinger_indexes_;
+
+        template <bool IsConst>
+        class Iterator
+        {
+            using Map = std::conditional_t<IsConst, const flat_map, flat_map>;
+
+            Map* map_;
+            size_t index_;
+
+            friend class flat_map;
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::pair<Key, Value>;
+            using reference = std::pair<const Key&, std::conditional_t<IsConst, const Value&, Value&>>;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator(Map& map, size_t index)
+                : map_{&map}
+                , index_{index}
+            {
+            }
+
+            operator Iterator<true>() const
+                requires(!IsConst)
+            {
+                return Iterator<true>{*map_, index_};
+            }
+
+            reference operator*() const
+            {
+                return reference{map_->keys_[index_], map_->values_[index_]};
+            }
+
+            Iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator it = *this;
+                ++index_;
+                return it;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return index_ == other.index_;
+            }
+        };
+
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        flat_map() = default;
+
+        explicit flat_map(Compare comp)
+            : comp_{std::move(comp)}
+        {
+        }
+
+        flat_map(std::initializer_list<std::pair<Key, Value>> items, Compare comp = Compare{})
+            : comp_{std::move(comp)}
+        {
+            insert(items.begin(), items.end());
+        }
+
+        size_t size() const
+        {
+            return keys_.size();
+        }
+
+        bool empty() const
+        {
+            return keys_.empty();
+        }
+
+        void reserve(size_t capacity)
+        {
+            keys_.reserve(capacity);
+            values_.reserve(capacity);
+        }
+
+        void clear()
+        {
+            keys_.clear();
+            values_.clear();
+            rebuild_search_index();
+        }
+
+        std::span<const Key> keys() const
+        {
+            return keys_;
+        }
+
+        std::span<Value> values()
+        {
+            return values_;
+        }
+
+        std::span<const Value> values() const
+        {
+            return values_;
+        }
+
+        iterator begin()
+        {
+            return iterator{*this, 0};
+        }
+
+        iterator end()
+        {
+            return iterator{*this, size()};
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator{*this, 0};
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator{*this, size()};
+        }
+
+        iterator lower_bound(const Key& key)
+        {
+            return iterator{*this, lower_bound_index(key)};
+        }
+
+        const_iterator lower_bound(const Key& key) const
+        {
+            return const_iterator{*this, lower_bound_index(key)};
+        }
+
+        iterator find(const Key& key)
+        {
+            return iterator{*this, find_index(key)};
+        }
+
+        const_iterator find(const Key& key) const
+        {
+            return const_iterator{*this, find_index(key)};
+        }
+
+        bool contains(const Key& key) const
+        {
+            return find_index(key) != size();
+        }
+
+        Value& at(const Key& key)
+        {
+            return values_[checked_index(key)];
+        }
+
+        const Value& at(const Key& key) const
+        {
+            return values_[checked_index(key)];
+        }
+
+        Value& operator[](const Key& key)
+        {
+            return values_[try_emplace(key).first.index_];
+        }
+
+        // does nothing if key is already in the map (like std::map::insert)
+        template <typename... TArgs>
+        std::pair<iterator, bool> try_emplace(const Key& key, TArgs&&... args)
+        {
+            const size_t index = lower_bound_index(key);
+            if (index != size() && !comp_(key, keys_[index]))
+                return {iterator{*this, index}, false};
+
+            values_.emplace(values_.begin() + index, std::forward<TArgs>(args)...);
+            try
+            {
+                keys_.insert(keys_.begin() + index, key);
+            }
+            catch (...)
+            {
+                values_.erase(values_.begin() + index);
+                throw;
+            }
+
+            rebuild_search_index();
+
+            return {iterator{*this, index}, true};
+        }
+
+        std::pair<iterator, bool> insert(const std::pair<Key, Value>& item)
+        {
+            return try_emplace(item.first, item.second);
+        }
+
+        template <typename TValue>
+        std::pair<iterator, bool> insert_or_assign(const Key& key, TValue&& value)
+        {
+            auto [it, is_inserted] = try_emplace(key, std::forward<TValue>(value));
+            if (!is_inserted)
+                values_[it.index_] = std::forward<TValue>(value);
+            return {it, is_inserted};
+        }
+
+        // bulk insertion - new items are sorted (skipped if already sorted) & merged with stored items in one pass
+        //  - the first of items with equal keys wins - like a sequence of std::map::insert
+        template <std::input_iterator TIterator>
+        void insert(TIterator first, TIterator last)
+        {
+            std::vector<std::pair<Key, Value>> new_items(first, last);
+
+            auto key_less = [this](const auto& a, const auto& b) { return comp_(a.first, b.first); };
+            auto key_equal = [this](const auto& a, const auto& b) { return !comp_(a.first, b.first) && !comp_(b.first, a.first); };
+
+            if (!std::is_sorted(new_items.begin(), new_items.end(), key_less))
+                std::stable_sort(new_items.begin(), new_items.end(), key_less);
+            new_items.erase(std::unique(new_items.begin(), new_items.end(), key_equal), new_items.end());
+
+            std::vector<Key> keys;
+            std::vector<Value> values;
+            keys.reserve(size() + new_items.size());
+            values.reserve(size() + new_items.size());
+
+            size_t i = 0;
+            auto new_item = new_items.begin();
+            while (i < size() || new_item != new_items.end())
+            {
+                if (new_item == new_items.end() || (i < size() && !comp_(new_item->first, keys_[i])))
+                {
+                    if (new_item != new_items.end() && !comp_(keys_[i], new_item->first))
+                        ++new_item; // key is already stored
+
+                    keys.push_back(std::move(keys_[i]));
+                    values.push_back(std::move(values_[i]));
+                    ++i;
+                }
+                else
+                {
+                    keys.push_back(std::move(new_item->first));
+                    values.push_back(std::move(new_item->second));
+                    ++new_item;
+                }
+            }
+
+            keys_ = std::move(keys);
+            values_ = std::move(values);
+            rebuild_search_index();
+        }
+
+        size_t erase(const Key& key)
+        {
+            const size_t index = find_index(key);
+            if (index == size())
+                return 0;
+
+            keys_.erase(keys_.begin() + index);
+            values_.erase(values_.begin() + index);
+            rebuild_search_index();
+
+            return 1;
+        }
+
+    private:
+        // index of the first key not less than key (size() if none)
+        size_t lower_bound_index(const Key& key) const
+        {
+            if constexpr (Layout == SearchLayout::eytzinger)
+                return eytzinger_lower_bound(key);
+            else
+                return branchless_lower_bound(key);
+        }
+
+        // comparison result selects the next range without a branch - no mispredictions
+        size_t branchless_lower_bound(const Key& key) const
+        {
+            if (keys_.empty())
+                return 0;
+
+            const Key* base = keys_.data();
+            size_t length = keys_.size();
+            while (length > 1)
+            {
+                const size_t half = length / 2;
+                base += static_cast<size_t>(comp_(base[half - 1], key)) * half;
+                length -= half;
+            }
+
+            return static_cast<size_t>(base - keys_.data()) + comp_(*base, key);
+        }
+
+        size_t eytzinger_lower_bound(const Key& key) const
+        {
+            const size_t n = keys_.size();
+
+            size_t k = 1;
+            while (k <= n)
+            {
+#if defined(__GNUC__)
+                if (16 * k <= n)
+                    __builtin_prefetch(eytzinger_keys_.data() + 16 * k); // 4 levels down
+#endif
+                k = 2 * k + comp_(eytzinger_keys_[k], key);
+            }
+
+            k >>= std::countr_one(k) + 1; // cancels right turns taken after the last left turn
+
+            return k == 0 ? n : eytzinger_indexes_[k];
+        }
+
+        size_t find_index(const Key& key) const
+        {
+            const size_t index = lower_bound_index(key);
+            return index != size() && !comp_(key, keys_[index]) ? index : size();
+        }
+
+        size_t checked_index(const Key& key) const
+        {
+            const size_t index = find_index(key);
+            if (index == size())
+                throw std::out_of_range("flat_map - key not found");
+            return index;
+        }
+
+        void rebuild_search_index()
+        {
+            if constexpr (Layout == SearchLayout::eytzinger)
+            {
+                eytzinger_keys_.resize(keys_.size() + 1);
+                eytzinger_indexes_.resize(keys_.size() + 1);
+
+                // in-order traversal of the implicit tree visits keys in sorted order
+                auto fill = [this](auto& self, size_t sorted_index, size_t k) -> size_t {
+                    if (k <= keys_.size())
+                    {
+                        sorted_index = self(self, sorted_index, 2 * k);
+                        eytzinger_keys_[k] = keys_[sorted_index];
+                        eytzinger_indexes_[k] = sorted_index++;
+                        sorted_index = self(self, sorted_index, 2 * k + 1);
+                    }
+                    return sorted_index;
+                };
+
+                fill(fill, 0, 1);
+            }
+        }
+    };
+
+    template <typename Key, typename Value, typename Compare = std::less<Key>>
+    using eytzinger_flat_map = flat_map<Key, Value, Compare, SearchLayout::eytzinger>;
+}
+
+#endif
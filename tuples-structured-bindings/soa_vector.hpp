@@ -0,0 +1,294 @@
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Containers
+{
+    template <typename... Ts>
+    class soa_vector;
+
+    /////////////////////////////////////////////////////////////////////////////
+    // soa_row - proxy for a row of soa_vector
+    //  - structured bindings refer to items stored in the columns (like std::vector<bool>::reference):
+    //      auto [id, name] = soa[i]; // assignment to name modifies soa
+    //  - to_tuple() - copy of the row
+    template <bool IsConst, typename... Ts>
+    class soa_row
+    {
+        using Container = std::conditional_t<IsConst, const soa_vector<Ts...>, soa_vector<Ts...>>;
+
+        Container* container_;
+        size_t index_;
+
+    public:
+        soa_row(Container& container, size_t index)
+            : container_{&container}
+            , index_{index}
+        {
+        }
+
+        soa_row(const soa_row&) = default;
+
+        // assignment writes values of a row - it does not rebind the proxy
+        soa_row& operator=(const soa_row& other)
+            requires(!IsConst)
+        {
+            return *this = other.to_tuple();
+        }
+
+        soa_row& operator=(const soa_row&)
+            requires IsConst
+        = delete;
+
+        soa_row& operator=(const std::tuple<Ts...>& values)
+            requires(!IsConst)
+        {
+            [&]<size_t... Is>(std::index_sequence<Is...>) {
+                ((get<Is>() = std::get<Is>(values)), ...);
+            }(std::index_sequence_for<Ts...>{});
+
+            return *this;
+        }
+
+        operator soa_row<true, Ts...>() const
+            requires(!IsConst)
+        {
+            return soa_row<true, Ts...>{*container_, index_};
+        }
+
+        template <size_t I>
+        auto& get() const
+        {
+            return container_->template column<I>()[index_];
+        }
+
+        std::tuple<Ts...> to_tuple() const
+        {
+            return [&]<size_t... Is>(std::index_sequence<Is...>) {
+                return std::tuple<Ts...>{get<Is>()...};
+            }(std::index_sequence_for<Ts...>{});
+        }
+
+        friend bool operator==(const soa_row& row, const std::tuple<Ts...>& values)
+        {
+            return row.to_tuple() == values;
+        }
+    };
+
+    // iterator for range-based for loops - rows are returned by value (proxies)
+    template <bool IsConst, typename... Ts>
+    class soa_iterator
+    {
+        using Container = std::conditional_t<IsConst, const soa_vector<Ts...>, soa_vector<Ts...>>;
+
+        Container* container_;
+        size_t index_;
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::tuple<Ts...>;
+        using reference = soa_row<IsConst, Ts...>;
+        using difference_type = std::ptrdiff_t;
+
+        soa_iterator(Container& container, size_t index)
+            : container_{&container}
+            , index_{index}
+        {
+        }
+
+        reference operator*() const
+        {
+            return reference{*container_, index_};
+        }
+
+        soa_iterator& operator++()
+        {
+            ++index_;
+            return *this;
+        }
+
+        soa_iterator operator++(int)
+        {
+            soa_iterator it = *this;
+            ++index_;
+            return it;
+        }
+
+        bool operator==(const soa_iterator& other) const
+        {
+            return index_ == other.index_;
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // soa_vector - struct of arrays: every field is stored in its own contiguous column
+    //  - column<I>() - span of a column (scans touch only the data they need & vectorize)
+    //  - soa[i] - row proxy with structured bindings
+    //  - emplace_back/push_back - strong exception guarantee
+    template <typename... Ts>
+    class soa_vector
+    {
+        static_assert(sizeof...(Ts) > 0, "soa_vector requires at least one column");
+        static_assert((!std::is_same_v<Ts, bool> && ...), "std::vector<bool> is not contiguous - use char or uint8_t for flags");
+
+        std::tuple<std::vector<Ts>...> columns_;
+
+    public:
+        using row = soa_row<false, Ts...>;
+        using const_row = soa_row<true, Ts...>;
+        using iterator = soa_iterator<false, Ts...>;
+        using const_iterator = soa_iterator<true, Ts...>;
+
+        template <size_t I>
+        using column_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+        soa_vector() = default;
+
+        soa_vector(std::initializer_list<std::tuple<Ts...>> rows)
+        {
+            reserve(rows.size());
+            for (const auto& values : rows)
+                push_back(values);
+        }
+
+        size_t size() const
+        {
+            return std::get<0>(columns_).size();
+        }
+
+        bool empty() const
+        {
+            return std::get<0>(columns_).empty();
+        }
+
+        void reserve(size_t capacity)
+        {
+            std::apply([capacity](auto&... columns) { (columns.reserve(capacity), ...); }, columns_);
+        }
+
+        void clear()
+        {
+            std::apply([](auto&... columns) { (columns.clear(), ...); }, columns_);
+        }
+
+        void pop_back()
+        {
+            std::apply([](auto&... columns) { (columns.pop_back(), ...); }, columns_);
+        }
+
+        template <typename... TArgs>
+            requires(sizeof...(TArgs) == sizeof...(Ts))
+        row emplace_back(TArgs&&... args)
+        {
+            [&]<size_t... Is>(std::index_sequence<Is...>) {
+                size_t no_of_pushed = 0;
+                try
+                {
+                    ((std::get<Is>(columns_).emplace_back(std::forward<TArgs>(args)), ++no_of_pushed), ...);
+                }
+                catch (...)
+                {
+                    ((Is < no_of_pushed ? std::get<Is>(columns_).pop_back() : void()), ...);
+                    throw;
+                }
+            }(std::index_sequence_for<Ts...>{});
+
+            return row{*this, size() - 1};
+        }
+
+        void push_back(const std::tuple<Ts...>& values)
+        {
+            std::apply([this](const auto&... items) { emplace_back(items...); }, values);
+        }
+
+        void push_back(std::tuple<Ts...>&& values)
+        {
+            std::apply([this](auto&... items) { emplace_back(std::move(items)...); }, values);
+        }
+
+        row operator[](size_t index)
+        {
+            return row{*this, index};
+        }
+
+        const_row operator[](size_t index) const
+        {
+            return const_row{*this, index};
+        }
+
+        row at(size_t index)
+        {
+            ensure_in_range(index);
+            return row{*this, index};
+        }
+
+        const_row at(size_t index) const
+        {
+            ensure_in_range(index);
+            return const_row{*this, index};
+        }
+
+        template <size_t I>
+        std::span<column_type<I>> column()
+        {
+            return std::get<I>(columns_);
+        }
+
+        template <size_t I>
+        std::span<const column_type<I>> column() const
+        {
+            return std::get<I>(columns_);
+        }
+
+        iterator begin()
+        {
+            return iterator{*this, 0};
+        }
+
+        iterator end()
+        {
+            return iterator{*this, size()};
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator{*this, 0};
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator{*this, size()};
+        }
+
+    private:
+        void ensure_in_range(size_t index) const
+        {
+            if (index >= size())
+                throw std::out_of_range("soa_vector - index out of range");
+        }
+    };
+}
+
+// tuple protocol of rows - structured bindings
+template <bool IsConst, typename... Ts>
+struct std::tuple_size<Containers::soa_row<IsConst, Ts...>> : std::integral_constant<size_t, sizeof...(Ts)>
+{
+};
+
+template <size_t I, bool IsConst, typename... Ts>
+struct std::tuple_element<I, Containers::soa_row<IsConst, Ts...>>
+{
+    using item_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+    using type = std::conditional_t<IsConst, const item_type&, item_type&>;
+};
+
+#endif
@@ -0,0 +1,176 @@
+#include "calc_stats.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// implementations from tests_structured_bindings.cpp
+std::tuple<int, int, double> calc_stats(const std::vector<int>& data);
+
+namespace SinceCpp17
+{
+    std::tuple<int, int, double> calc_stats(const std::vector<int>& data);
+}
+
+namespace
+{
+    std::vector<int> make_random_data(size_t size, int min, int max)
+    {
+        std::mt19937 rnd{static_cast<unsigned>(size)};
+        std::uniform_int_distribution<int> distr{min, max};
+
+        std::vector<int> data(size);
+        for (auto& item : data)
+            item = distr(rnd);
+        return data;
+    }
+
+    double population_variance(const std::vector<int>& data)
+    {
+        const double avg = std::accumulate(data.begin(), data.end(), 0.0) / data.size();
+        return std::accumulate(data.begin(), data.end(), 0.0, [avg](double acc, int x) { return acc + (x - avg) * (x - avg); }) / data.size();
+    }
+
+    // nearest-rank percentile
+    int exact_percentile(std::vector<int> data, double p)
+    {
+        const auto rank = std::max<size_t>(1, static_cast<size_t>(std::ceil(p / 100.0 * data.size())));
+        std::nth_element(data.begin(), data.begin() + (rank - 1), data.end());
+        return data[rank - 1];
+    }
+}
+
+TEST_CASE("Parallel::calc_stats")
+{
+    std::vector<int> data = {4, 42, 665, 1, 123, 13};
+
+    SECTION("the same min, max & avg as calc_stats")
+    {
+        auto [min, max, avg] = Parallel::calc_stats(data).min_max_avg();
+
+        REQUIRE(std::tuple(min, max, avg) == calc_stats(data));
+        REQUIRE(avg == Catch::Approx(141.333));
+    }
+
+    SECTION("variance & percentiles")
+    {
+        const auto stats = Parallel::calc_stats(data);
+
+        REQUIRE(stats.variance() == Catch::Approx(population_variance(data)));
+        REQUIRE(stats.median() == 13); // values below 64 are exact
+        REQUIRE(stats.percentile(0) == 1);
+        REQUIRE(stats.percentile(100) == 665);
+    }
+
+    SECTION("streaming updates")
+    {
+        Parallel::StatsAccumulator stats;
+        for (int x : data)
+            stats.update(x);
+
+        REQUIRE(stats.min_max_avg() == calc_stats(data));
+        REQUIRE(stats.variance() == Catch::Approx(population_variance(data)));
+
+        stats.update(-1000);
+        REQUIRE(stats.min() == -1000);
+        REQUIRE(stats.count() == 7);
+    }
+
+    SECTION("empty data")
+    {
+        const auto stats = Parallel::calc_stats(std::vector<int>{});
+
+        REQUIRE(stats.count() == 0);
+        REQUIRE_THROWS_AS(stats.avg(), std::out_of_range);
+        REQUIRE_THROWS_AS(stats.median(), std::out_of_range);
+    }
+}
+
+TEST_CASE("Parallel::calc_stats - chunks, threads & SIMD blocks")
+{
+    for (auto [size, min, max] : {std::tuple{100'003, INT_MIN, INT_MAX}, {300'007, -1000, 1000}, {1'000, 0, 50}})
+    {
+        INFO("size: " << size << ", range: [" << min << ", " << max << "]");
+
+        const auto data = make_random_data(size, min, max);
+
+        Parallel::StatsAccumulator by_value;
+        for (int x : data)
+            by_value.update(x);
+
+        for (size_t no_of_threads : {1, 4})
+        {
+            const auto stats = Parallel::calc_stats(data, no_of_threads);
+
+            REQUIRE(stats.count() == data.size());
+            REQUIRE(stats.sum() == std::accumulate(data.begin(), data.end(), int64_t{0}));
+            REQUIRE(stats.min_max_avg() == calc_stats(data));
+            REQUIRE(stats.variance() == Catch::Approx(population_variance(data)));
+            REQUIRE(by_value.variance() == Catch::Approx(population_variance(data)));
+
+            for (double p : {1.0, 25.0, 50.0, 90.0, 99.9})
+            {
+                const auto expected = exact_percentile(data, p);
+                const auto percentile = stats.percentile(p);
+
+                INFO("p" << p << ": " << percentile << " vs " << expected);
+                REQUIRE(std::abs(percentile - expected) <= std::abs(expected) / 32 + 1);
+                REQUIRE(percentile == by_value.percentile(p));
+            }
+        }
+    }
+}
+
+TEST_CASE("QuantileSketch - buckets preserve order")
+{
+    const std::vector<int> values = {INT_MIN, -1'000'000'000, -65, -64, -63, -1, 0, 1, 63, 64, 65, 16'777'217, INT_MAX};
+
+    for (size_t i = 1; i < values.size(); ++i)
+        REQUIRE(Parallel::QuantileSketch::bucket_of(values[i - 1]) <= Parallel::QuantileSketch::bucket_of(values[i]));
+
+    for (int x : {-63, -1, 0, 1, 2, 17, 63})
+        REQUIRE(Parallel::QuantileSketch::value_of(Parallel::QuantileSketch::bucket_of(x)) == x);
+
+    REQUIRE(Parallel::QuantileSketch::bucket_of(INT_MIN) == 0);
+    REQUIRE(Parallel::QuantileSketch::bucket_of(INT_MAX) < Parallel::QuantileSketch::no_of_buckets);
+}
+
+TEST_CASE("calc_stats - two passes vs single pass", "[.][benchmark]")
+{
+    // 10^9 ints (4 GB) do not fit in memory of a typical CI runner - 10^8 is the largest size
+    for (size_t size : {10'000, 1'000'000, 100'000'000})
+    {
+        const auto data = make_random_data(size, -1'000'000, 1'000'000);
+        const std::string title = " - size: " + std::to_string(size);
+
+        BENCHMARK("calc_stats - minmax_element + accumulate" + title)
+        {
+            return calc_stats(data);
+        };
+
+        BENCHMARK("SinceCpp17::calc_stats" + title)
+        {
+            return SinceCpp17::calc_stats(data);
+        };
+
+        BENCHMARK("Parallel::calc_stats - 1 thread (+ variance & sketch)" + title)
+        {
+            return Parallel::calc_stats(data, 1).min_max_avg();
+        };
+
+        BENCHMARK("Parallel::calc_stats - all threads (+ variance & sketch)" + title)
+        {
+            return Parallel::calc_stats(data).min_max_avg();
+        };
+    }
+}
@@ -0,0 +1,185 @@
+#include "flat_map.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using Containers::flat_map;
+
+TEMPLATE_TEST_CASE("flat_map", "", (flat_map<int, std::string>), (Containers::eytzinger_flat_map<int, std::string>))
+{
+    TestType dict = {{3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}};
+
+    REQUIRE(dict.size() == 3);
+
+    SECTION("iteration in order of keys - structured bindings")
+    {
+        std::vector<std::pair<int, std::string>> items;
+        for (const auto& [key, value] : dict)
+            items.emplace_back(key, value);
+
+        REQUIRE(items == std::vector<std::pair<int, std::string>>{{1, "one"}, {2, "two"}, {3, "three"}});
+    }
+
+    SECTION("values can be modified through bindings")
+    {
+        for (auto [key, value] : dict)
+            value += "!";
+
+        REQUIRE(dict.at(2) == "two!");
+    }
+
+    SECTION("lookup")
+    {
+        REQUIRE(dict.contains(3));
+        REQUIRE_FALSE(dict.contains(4));
+        REQUIRE(dict.find(4) == dict.end());
+        REQUIRE((*dict.find(2)).second == "two");
+        REQUIRE_THROWS_AS(dict.at(0), std::out_of_range);
+    }
+
+    SECTION("insert & erase")
+    {
+        REQUIRE_FALSE(dict.insert({2, "dwa"}).second);
+        REQUIRE(dict.insert_or_assign(2, "dwa").second == false);
+        REQUIRE(dict[2] == "dwa");
+
+        dict[0] = "zero";
+        REQUIRE(dict.keys().front() == 0);
+
+        REQUIRE(dict.erase(1) == 1);
+        REQUIRE(dict.erase(1) == 0);
+        REQUIRE(std::ranges::equal(dict.keys(), std::vector{0, 2, 3}));
+    }
+
+    SECTION("bulk insert - sort & merge")
+    {
+        std::vector<std::pair<int, std::string>> items = {{10, "ten"}, {2, "dwa"}, {5, "five"}, {-1, "minus one"}, {5, "pięć"}};
+        dict.insert(items.begin(), items.end());
+
+        REQUIRE(std::ranges::equal(dict.keys(), std::vector{-1, 1, 2, 3, 5, 10}));
+        REQUIRE(dict.at(2) == "two");
+        REQUIRE(dict.at(5) == "five");
+    }
+}
+
+TEMPLATE_TEST_CASE("flat_map - lower_bound for all sizes of the search tree", "", (flat_map<int, int>), (Containers::eytzinger_flat_map<int, int>))
+{
+    for (int size = 0; size <= 70; ++size)
+    {
+        TestType map;
+        for (int i = 0; i < size; ++i)
+            map[2 * i] = i;
+
+        for (int key = -1; key <= 2 * size + 1; ++key)
+        {
+            INFO("size: " << size << ", key: " << key);
+
+            const auto expected = std::lower_bound(map.keys().begin(), map.keys().end(), key) - map.keys().begin();
+            REQUIRE(map.lower_bound(key) == typename TestType::const_iterator{map, static_cast<size_t>(expected)});
+            REQUIRE(map.contains(key) == (key >= 0 && key % 2 == 0 && key < 2 * size));
+        }
+    }
+}
+
+TEST_CASE("flat_map - custom comparer")
+{
+    flat_map<std::string, int, std::greater<>> dict = {{"a", 1}, {"c", 3}, {"b", 2}};
+
+    REQUIRE(std::ranges::equal(dict.keys(), std::vector<std::string>{"c", "b", "a"}));
+    REQUIRE(dict.at("b") == 2);
+}
+
+TEST_CASE("flat_map vs std::map vs std::unordered_map", "[.][benchmark]")
+{
+    constexpr size_t no_of_lookups = 1'000;
+
+    for (size_t size : {10, 1'000, 1'000'000})
+    {
+        std::mt19937_64 rnd{size};
+
+        std::vector<std::pair<uint64_t, uint64_t>> items(size);
+        for (auto& [key, value] : items)
+            key = value = rnd();
+
+        std::map<uint64_t, uint64_t> tree(items.begin(), items.end());
+        std::unordered_map<uint64_t, uint64_t> hash_map(items.begin(), items.end());
+        flat_map<uint64_t, uint64_t> sorted;
+        sorted.insert(items.begin(), items.end());
+        Containers::eytzinger_flat_map<uint64_t, uint64_t> eytzinger;
+        eytzinger.insert(items.begin(), items.end());
+
+        std::vector<uint64_t> keys(no_of_lookups);
+        std::uniform_int_distribution<size_t> index_distr{0, size - 1};
+        for (auto& key : keys)
+            key = items[index_distr(rnd)].first;
+
+        const std::string title = " - size: " + std::to_string(size);
+
+        BENCHMARK("lookup - std::map" + title)
+        {
+            uint64_t sum = 0;
+            for (uint64_t key : keys)
+                sum += tree.find(key)->second;
+            return sum;
+        };
+
+        BENCHMARK("lookup - std::unordered_map" + title)
+        {
+            uint64_t sum = 0;
+            for (uint64_t key : keys)
+                sum += hash_map.find(key)->second;
+            return sum;
+        };
+
+        BENCHMARK("lookup - flat_map (branchless)" + title)
+        {
+            uint64_t sum = 0;
+            for (uint64_t key : keys)
+                sum += (*sorted.find(key)).second;
+            return sum;
+        };
+
+        BENCHMARK("lookup - flat_map (eytzinger)" + title)
+        {
+            uint64_t sum = 0;
+            for (uint64_t key : keys)
+                sum += (*eytzinger.find(key)).second;
+            return sum;
+        };
+
+        BENCHMARK("iteration - std::map" + title)
+        {
+            uint64_t sum = 0;
+            for (const auto& [key, value] : tree)
+                sum += value;
+            return sum;
+        };
+
+        BENCHMARK("iteration - std::unordered_map" + title)
+        {
+            uint64_t sum = 0;
+            for (const auto& [key, value] : hash_map)
+                sum += value;
+            return sum;
+        };
+
+        BENCHMARK("iteration - flat_map" + title)
+        {
+            uint64_t sum = 0;
+            for (const auto& [key, value] : sorted)
+                sum += value;
+            return sum;
+        };
+    }
+}
@@ -0,0 +1,172 @@
+#include "soa_vector.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using Containers::soa_vector;
+
+TEST_CASE("soa_vector")
+{
+    soa_vector<int, std::string, double> products = {{1, "ipad", 999.0}, {2, "mouse", 49.99}};
+
+    products.emplace_back(3, "keyboard", 129.0);
+
+    REQUIRE(products.size() == 3);
+
+    SECTION("row with structured bindings")
+    {
+        auto [id, name, price] = products[2];
+
+        REQUIRE(id == 3);
+        REQUIRE(name == "keyboard");
+        REQUIRE(price == 129.0);
+
+        SECTION("names refer to items of columns")
+        {
+            price *= 0.9;
+            REQUIRE(products.column<2>()[2] == 129.0 * 0.9);
+        }
+    }
+
+    SECTION("copy of a row")
+    {
+        std::tuple<int, std::string, double> row = products[0].to_tuple();
+        std::get<1>(row) = "ipad pro";
+
+        REQUIRE(products[0] == std::tuple{1, std::string{"ipad"}, 999.0});
+
+        products[1] = row;
+        REQUIRE(products[1] == row);
+    }
+
+    SECTION("columns are contiguous")
+    {
+        std::span<double> prices = products.column<2>();
+
+        REQUIRE(prices.size() == 3);
+        REQUIRE(std::accumulate(prices.begin(), prices.end(), 0.0) == 999.0 + 49.99 + 129.0);
+    }
+
+    SECTION("range-based for with structured bindings")
+    {
+        for (auto [id, name, price] : products)
+            price += id;
+
+        std::vector<std::string> names;
+        const auto& const_products = products;
+        for (const auto& [id, name, price] : const_products)
+            names.push_back(name);
+
+        REQUIRE(products.column<2>()[0] == 1000.0);
+        REQUIRE(names == std::vector<std::string>{"ipad", "mouse", "keyboard"});
+    }
+
+    SECTION("at() checks index")
+    {
+        REQUIRE_THROWS_AS(products.at(3), std::out_of_range);
+    }
+
+    SECTION("pop_back & clear")
+    {
+        products.pop_back();
+        REQUIRE(products.size() == 2);
+
+        products.clear();
+        REQUIRE(products.empty());
+    }
+}
+
+namespace
+{
+    struct ThrowingOnCopy
+    {
+        ThrowingOnCopy() = default;
+        ThrowingOnCopy(ThrowingOnCopy&&) noexcept = default;
+
+        ThrowingOnCopy(const ThrowingOnCopy&)
+        {
+            throw std::runtime_error("ERROR");
+        }
+    };
+}
+
+TEST_CASE("soa_vector - exception in emplace_back leaves columns of equal size")
+{
+    soa_vector<std::string, ThrowingOnCopy> items;
+    items.emplace_back("one", ThrowingOnCopy{}); // move - no exception
+
+    const ThrowingOnCopy item;
+    REQUIRE_THROWS_AS(items.emplace_back("two", item), std::runtime_error);
+
+    REQUIRE(items.size() == 1);
+    REQUIRE(items.column<0>().size() == 1);
+    REQUIRE(items.column<1>().size() == 1);
+}
+
+TEST_CASE("soa_vector vs vector<tuple>", "[.][benchmark]")
+{
+    constexpr size_t size = 1'000'000;
+
+    std::mt19937 rnd{665};
+    std::uniform_int_distribution<int> distr{0, 1000};
+
+    std::vector<std::tuple<int, std::string, double>> rows;
+    soa_vector<int, std::string, double> columns;
+    rows.reserve(size);
+    columns.reserve(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        const int id = distr(rnd);
+        rows.emplace_back(id, "product", id * 0.5);
+        columns.emplace_back(id, "product", id * 0.5);
+    }
+
+    std::vector<size_t> random_indexes(size);
+    std::iota(random_indexes.begin(), random_indexes.end(), 0);
+    std::shuffle(random_indexes.begin(), random_indexes.end(), rnd);
+
+    BENCHMARK("column sum - vector<tuple>")
+    {
+        int64_t sum = 0;
+        for (const auto& [id, name, price] : rows)
+            sum += id;
+        return sum;
+    };
+
+    BENCHMARK("column sum - soa_vector::column")
+    {
+        auto ids = columns.column<0>();
+        return std::reduce(ids.begin(), ids.end(), int64_t{0});
+    };
+
+    BENCHMARK("row access (random order) - vector<tuple>")
+    {
+        double total = 0.0;
+        for (size_t i : random_indexes)
+        {
+            const auto& [id, name, price] = rows[i];
+            total += id * price + name.size();
+        }
+        return total;
+    };
+
+    BENCHMARK("row access (random order) - soa_vector")
+    {
+        double total = 0.0;
+        for (size_t i : random_indexes)
+        {
+            auto [id, name, price] = columns[i];
+            total += id * price + name.size();
+        }
+        return total;
+    };
+}
@@ -1,3 +1,5 @@
+#include "flat_map.hpp"
+
 #include <algorithm>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -64,4 +66,12 @@ TEST_CASE("structured bindings use case")
     {
         std::cout << key << " - " << value << "\n";
     }
+
+    // flat_map - sorted vectors of keys & values: the same structured bindings, no tree nodes
+    Containers::flat_map<int, std::string> flat_dict = { {1, "one"}, {2, "two"} };
+
+    for(const auto& [key, value] : flat_dict)
+    {
+        std::cout << key << " - " << value << "\n";
+    }
 }
\ No newline at end of file